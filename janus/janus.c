@@ -1,8 +1,14 @@
 
+/* clock_gettime(...) and nanosleep(...) are POSIX, so ask for them when building for a PC with -std=c99 */
+#if !defined(__TICE__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include <tice.h>
 #include <keypadc.h>
 #include <graphx.h>
 #include <time.h>
+#include <string.h>
 
 #include <debug.h>
 #include "janus.h"
@@ -10,6 +16,9 @@
 uint8_t janus_ReleasedKeys[KB_DATA_SIZE];
 uint8_t janus_PressedKeys[KB_DATA_SIZE];
 uint8_t janus_PressedOrReleasedKeys[KB_DATA_SIZE];
+#if JANUS_PROFILER
+struct janus_Profiler janus_Profiler;
+#endif
 
 
 uint24_t janus_Max(uint24_t x, uint24_t y) {
@@ -54,24 +63,154 @@ int24_t janus_LerpInt24(int24_t x, int24_t y, float alpha) {
 int24_t janus_LerpInt24ByInt(int24_t x, int24_t y, int24_t alpha) {
     return x + JANUS_APPLY_DELTA_TIME((y - x),alpha);
 }
-int24_t janus_Pow(int24_t x, int24_t y) {
-    return y > 0 ? x*janus_Pow(x,y-1) : 1;
-}
 
 float janus_Sin(float x) {
     return (16.0f*x*(JANUS_PI - x)) / ((5.0f*JANUS_PI*JANUS_PI) - (4.0f*x*(JANUS_PI-x)));
 }
 
+int24_t janus_Pow(int24_t x, int24_t y) {
+    int24_t result = 1;
+    /* Exponentiation by squaring; one multiply per bit of y instead of one per unit */
+    while(y > 0) {
+        if(y & 1) {
+            result *= x;
+        }
+        y >>= 1;
+        if(y > 0) {
+            x *= x;
+        }
+    }
+    return result;
+}
+uint24_t janus_SquareRoot(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = (uint32_t)1 << 30;
+    /* One result bit per loop with no multiplies or divides */
+    while(bit > value) {
+        bit >>= 2;
+    }
+    while(bit != 0) {
+        if(value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/* floor(2^29 / 1000); shift is 20 + floor(log2(1000)) */
+static const struct janus_Reciprocal janus_OneSecondReciprocal = {JANUS_ONE_SECOND,536870,29};
+
+void janus_InitReciprocal(struct janus_Reciprocal* reciprocal, uint24_t divisor) {
+    uint8_t log2Divisor = 0;
+    while((divisor >> (log2Divisor + 1)) != 0) {
+        log2Divisor++;
+    }
+    reciprocal->divisor = divisor;
+    /* Past 31 the shift itself stops fitting; large divisors have small quotients, so the lost precision doesn't matter */
+    reciprocal->shift = log2Divisor < 32 - JANUS_RECIPROCAL_BITS ? JANUS_RECIPROCAL_BITS + log2Divisor : 31;
+    reciprocal->multiplier = ((uint32_t)1 << reciprocal->shift) / divisor;
+}
+int24_t janus_DivideByReciprocal(int24_t value, const struct janus_Reciprocal* reciprocal) {
+    uint24_t dividend = JANUS_ABS(value);
+    uint24_t quotient, remainder;
+    /* Multiplying the top and bottom 12 bits separately keeps both products within 32 bits;
+       the multiplier rounds down, so the estimate is never too big and only ever a few steps too small */
+    quotient = ((uint32_t)(dividend >> 12) * reciprocal->multiplier + (((uint32_t)(dividend & 0xFFF) * reciprocal->multiplier) >> 12)) >> (reciprocal->shift - 12);
+    remainder = dividend - quotient * reciprocal->divisor;
+    while(remainder >= reciprocal->divisor) {
+        remainder -= reciprocal->divisor;
+        quotient++;
+    }
+    return value < 0 ? -(int24_t)quotient : (int24_t)quotient;
+}
+int24_t janus_DivideByOneSecond(int24_t value) {
+    return janus_DivideByReciprocal(value,&janus_OneSecondReciprocal);
+}
+
+/* round(256 * sin(i * 2pi / 256)) for the first quarter turn; the other quarters are mirrored from it. Generated by tests/gen_tables.c */
+static const uint16_t janus_SinTable[JANUS_ANGLE_QUARTER + 1] = {
+    0, 6, 13, 19, 25, 31, 38, 44, 50, 56, 62, 68, 74, 80, 86, 92,
+    98, 104, 109, 115, 121, 126, 132, 137, 142, 147, 152, 157, 162, 167, 172, 177,
+    181, 185, 190, 194, 198, 202, 206, 209, 213, 216, 220, 223, 226, 229, 231, 234,
+    237, 239, 241, 243, 245, 247, 248, 250, 251, 252, 253, 254, 255, 255, 256, 256,
+    256
+};
+
+/* round(atan(i / 64) * 256 / 2pi), the angle of a slope of i / 64 up to 45 degrees. Generated by tests/gen_tables.c */
+static const uint8_t janus_AtanTable[(1 << JANUS_ATAN_SHIFT) + 1] = {
+    0, 1, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 8, 9, 9,
+    10, 11, 11, 12, 12, 13, 13, 14, 15, 15, 16, 16, 17, 17, 18, 18,
+    19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 25, 26,
+    26, 27, 27, 27, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32,
+    32
+};
+
+int24_t janus_SinFixed(uint8_t angle) {
+    uint8_t index = angle & (JANUS_ANGLE_QUARTER - 1);
+    int24_t value;
+    if(angle & JANUS_ANGLE_QUARTER) {
+        index = JANUS_ANGLE_QUARTER - index;
+    }
+    value = janus_SinTable[index];
+    return (angle & (JANUS_ANGLE_QUARTER * 2)) ? -value : value;
+}
+int24_t janus_CosFixed(uint8_t angle) {
+    return janus_SinFixed(angle + JANUS_ANGLE_QUARTER);
+}
+uint8_t janus_Atan2(int24_t y, int24_t x) {
+    int24_t absX = JANUS_ABS(x);
+    int24_t absY = JANUS_ABS(y);
+    uint8_t angle;
+    if(absX == 0 && absY == 0) {
+        return 0;
+    }
+    /* Fold into the first octant so the table only has to cover slopes from 0 to 1 */
+    if(absY <= absX) {
+        angle = janus_AtanTable[(((int32_t)absY << JANUS_ATAN_SHIFT) + (absX >> 1)) / absX];
+    } else {
+        angle = JANUS_ANGLE_QUARTER - janus_AtanTable[(((int32_t)absX << JANUS_ATAN_SHIFT) + (absY >> 1)) / absY];
+    }
+    if(x < 0) {
+        angle = JANUS_ANGLE_QUARTER * 2 - angle;
+    }
+    return y < 0 ? (uint8_t)-angle : angle;
+}
+
+uint24_t janus_VectorLength(struct janus_Vector2* vector) {
+    return janus_SquareRoot((uint32_t)((int32_t)vector->x * vector->x) + (uint32_t)((int32_t)vector->y * vector->y));
+}
+struct janus_Vector2 janus_NormalizeVector(struct janus_Vector2* vector, int24_t length) {
+    int24_t vectorLength = janus_VectorLength(vector);
+    if(vectorLength == 0) {
+        return (struct janus_Vector2){0,0};
+    }
+    return (struct janus_Vector2){(int32_t)vector->x * length / vectorLength,(int32_t)vector->y * length / vectorLength};
+}
+
 
 
+bool janus_LayersCollide(struct janus_Rect* object1, struct janus_Rect* object2) {
+    return (JANUS_LAYER_BITS(object1->layer) & JANUS_LAYER_BITS(object2->mask)) && (JANUS_LAYER_BITS(object2->layer) & JANUS_LAYER_BITS(object1->mask));
+}
+
 bool janus_Collision(struct janus_Rect* object1, struct janus_Rect* object2) {
     return object1->position.x + object1->size.x > object2->position.x && object1->position.y + object1->size.y > object2->position.y && object2->position.y + object2->size.y > object1->position.y && object2->position.x + object2->size.x > object1->position.x;
 }
 
-bool janus_HandleObjectObjectCollision(struct janus_PhysicsObject* object1, struct janus_PhysicsObject* object2) {
-    bool onFloor = false;
-    if(!janus_Collision(&object1->rect,&object2->rect)) {
-        return false;
+/* Which way janus_ResolveObjectObjectCollision pushed object1 */
+#define JANUS_CONTACT_NONE 0
+#define JANUS_CONTACT_SIDE 1
+#define JANUS_CONTACT_ON_TOP 2 // object1 rests on object2
+#define JANUS_CONTACT_BELOW 3 // object2 rests on object1
+
+static uint8_t janus_ResolveObjectObjectCollision(struct janus_PhysicsObject* object1, struct janus_PhysicsObject* object2) {
+    uint8_t contact = JANUS_CONTACT_SIDE;
+    if(object1->trigger || object2->trigger || !janus_LayersCollide(&object1->rect,&object2->rect) || !janus_Collision(&object1->rect,&object2->rect)) {
+        return JANUS_CONTACT_NONE;
     }
     int24_t obj1RightWall = object1->rect.position.x + object1->rect.size.x;
     int24_t obj2RightWall = object2->rect.position.x + object2->rect.size.x;
@@ -110,7 +249,7 @@ bool janus_HandleObjectObjectCollision(struct janus_PhysicsObject* object1, stru
         object2->rect.position.y -= amt2;
         object1->velocity.y -= ((object1->velocity.y) < 0 ? -1 : 0) * janus_Min(JANUS_ABS(amt1),JANUS_ABS(object1->velocity.y));
         object2->velocity.y -= ((object2->velocity.y) < 0 ? -1 : 0) * janus_Min(JANUS_ABS(amt2),JANUS_ABS(object2->velocity.y));
-        onFloor = true;
+        contact = JANUS_CONTACT_ON_TOP;
     } else if(smallestMovement == JANUS_ABS(pushObj1Down)) {
         int24_t amt1 = pushObj1Down * object1Influence / totalInfluence;
         int24_t amt2 = pushObj1Down * object2Influence / totalInfluence;
@@ -118,13 +257,18 @@ bool janus_HandleObjectObjectCollision(struct janus_PhysicsObject* object1, stru
         object2->rect.position.y -= amt2;
         object1->velocity.y -= ((object1->velocity.y) < 0 ? -1 : 0) * janus_Min(JANUS_ABS(amt1),JANUS_ABS(object1->velocity.y));
         object2->velocity.y -= ((object2->velocity.y) < 0 ? -1 : 0) * janus_Min(JANUS_ABS(amt2),JANUS_ABS(object2->velocity.y));
+        contact = JANUS_CONTACT_BELOW;
     }
-    return onFloor;
+    return contact;
+}
+
+bool janus_HandleObjectObjectCollision(struct janus_PhysicsObject* object1, struct janus_PhysicsObject* object2) {
+    return janus_ResolveObjectObjectCollision(object1,object2) == JANUS_CONTACT_ON_TOP;
 }
 
 bool janus_HandleObjectRectCollision(struct janus_PhysicsObject* object1, struct janus_Rect* rect) {
     bool onFloor = false;
-    if(!janus_Collision(&object1->rect,rect)) {
+    if(!janus_LayersCollide(&object1->rect,rect) || !janus_Collision(&object1->rect,rect)) {
         return false;
     }
     int24_t obj1RightWall = object1->rect.position.x + object1->rect.size.x;
@@ -156,188 +300,2508 @@ bool janus_HandleObjectRectCollision(struct janus_PhysicsObject* object1, struct
     return onFloor;
 }
 
+/* distance * 1000 / move, worked out in 32 bits and clamped to int24 so big gaps in scrolling worlds can't overflow */
+static int24_t janus_SweepTime(int24_t distance, int24_t move) {
+    int32_t time = (int32_t)distance * JANUS_ONE_SECOND / move;
+    if(time > 0x7FFFFF) {
+        return 0x7FFFFF;
+    }
+    if(time < -0x7FFFFF) {
+        return -0x7FFFFF;
+    }
+    return time;
+}
 
-void janus_AddForce(struct janus_PhysicsObject* object, struct janus_Vector2* velocity) { 
-    object->velocity = janus_AddVectors(&object->velocity,velocity);
+/* move * time / 1000 for a sweep time of 0 to 1000, worked out in 32 bits and split so even moves near the int24 limit can't overflow */
+static int24_t janus_SweepOffset(int24_t move, int24_t time) {
+    return (int32_t)(move / JANUS_ONE_SECOND) * time + (int32_t)(move % JANUS_ONE_SECOND) * time / JANUS_ONE_SECOND;
 }
 
-void janus_DampenVelocity(struct janus_PhysicsObject* object, struct janus_Vector2* dampen) {
-    struct janus_Vector2 divided = janus_DivideVectors(&object->velocity,dampen);
-    object->velocity = janus_SubtractVectors(&object->velocity,&divided);
+/* Finds when (0-1000) one axis of a moving rect starts and stops overlapping a still one; returns false if it never does */
+static bool janus_SweepAxis(int24_t movingStart, int24_t movingSize, int24_t move, int24_t rectStart, int24_t rectSize, int24_t* entry, int24_t* exit) {
+    if(move == 0) {
+        if(movingStart + movingSize <= rectStart || rectStart + rectSize <= movingStart) {
+            return false;
+        }
+        *entry = -0x7FFFFF;
+        *exit = 0x7FFFFF;
+    } else if(move > 0) {
+        *entry = janus_SweepTime(rectStart - (movingStart + movingSize),move);
+        *exit = janus_SweepTime(rectStart + rectSize - movingStart,move);
+    } else {
+        *entry = janus_SweepTime(rectStart + rectSize - movingStart,move);
+        *exit = janus_SweepTime(rectStart - (movingStart + movingSize),move);
+    }
+    return true;
 }
 
-void janus_ApplyVelocity(struct janus_PhysicsObject* object, int24_t deltaMS) {
+bool janus_SweepRect(struct janus_Rect* moving, struct janus_Vector2* movement, struct janus_Rect* rect, struct janus_SweepHit* hit) {
+    int24_t entryX, exitX, entryY, exitY, entry, exit;
+
+    if(!janus_LayersCollide(moving,rect)) {
+        return false;
+    }
+    if(!janus_SweepAxis(moving->position.x,moving->size.x,movement->x,rect->position.x,rect->size.x,&entryX,&exitX)) {
+        return false;
+    }
+    if(!janus_SweepAxis(moving->position.y,moving->size.y,movement->y,rect->position.y,rect->size.y,&entryY,&exitY)) {
+        return false;
+    }
+    entry = entryX > entryY ? entryX : entryY;
+    exit = exitX < exitY ? exitX : exitY;
+    if(entry >= exit || entry < 0 || entry > JANUS_ONE_SECOND) {
+        return false;
+    }
+
+    hit->time = entry;
+    hit->normal = (struct janus_Vector2){0,0};
+    /* Snap the blocked axis to the rect's edge so rounding never leaves the rects overlapping */
+    if(entryX > entryY) {
+        hit->normal.x = movement->x > 0 ? -1 : 1;
+        hit->position.x = movement->x > 0 ? rect->position.x - moving->size.x : rect->position.x + rect->size.x;
+        hit->position.y = moving->position.y + janus_SweepOffset(movement->y,entry);
+    } else {
+        hit->normal.y = movement->y > 0 ? -1 : 1;
+        hit->position.x = moving->position.x + janus_SweepOffset(movement->x,entry);
+        hit->position.y = movement->y > 0 ? rect->position.y - moving->size.y : rect->position.y + rect->size.y;
+    }
+    return true;
+}
+
+bool janus_ApplyVelocitySwept(struct janus_PhysicsObject* object, int24_t deltaMS, struct janus_Rect* rects, uint8_t rectCount) {
+    bool onFloor = false;
     struct janus_Vector2 delta = (struct janus_Vector2){JANUS_APPLY_DELTA_TIME(object->velocity.x,deltaMS),JANUS_APPLY_DELTA_TIME(object->velocity.y,deltaMS)};
-    object->rect.position = janus_AddVectors(&object->rect.position,&delta);
+    struct janus_Vector2 remaining = delta;
+    uint8_t pass, i;
+
+    object->previousPosition = object->rect.position;
     object->velocity = janus_SubtractVectors(&object->velocity,&delta);
+
+    /* Each pass moves to the first contact and slides along it; a corner takes at most two */
+    for(pass = 0; pass < 3 && (remaining.x != 0 || remaining.y != 0); pass++) {
+        struct janus_SweepHit first, hit;
+        bool hitSomething = false;
+        first.time = JANUS_ONE_SECOND + 1;
+        for(i = 0; i < rectCount; i++) {
+            if(janus_SweepRect(&object->rect,&remaining,&rects[i],&hit) && hit.time < first.time) {
+                first = hit;
+                hitSomething = true;
+            }
+        }
+        if(!hitSomething) {
+            object->rect.position = janus_AddVectors(&object->rect.position,&remaining);
+            break;
+        }
+        object->rect.position = first.position;
+        if(first.normal.x != 0) {
+            object->velocity.x = 0;
+            remaining.x = 0;
+            remaining.y -= janus_SweepOffset(remaining.y,first.time);
+        } else {
+            object->velocity.y = 0;
+            remaining.y = 0;
+            remaining.x -= janus_SweepOffset(remaining.x,first.time);
+            if(first.normal.y < 0) {
+                onFloor = true;
+            }
+        }
+    }
+    return onFloor;
 }
 
+/* Faces of a tile that an object can be pushed out through */
+#define JANUS_TILE_FACE_LEFT 1
+#define JANUS_TILE_FACE_RIGHT 2
+#define JANUS_TILE_FACE_UP 4
+#define JANUS_TILE_FACE_DOWN 8
+/* Stands in for the push through a closed face so it never wins */
+#define JANUS_TILE_CLOSED_FACE 0x7FFFFF
 
-void janus_UpdateDebouncedKeys(void) {
-    static uint8_t janus_LastPressed[KB_DATA_SIZE];
-    uint8_t i;
-    for(i = 1; i < KB_DATA_SIZE; i++) {
-        janus_PressedOrReleasedKeys[i] = janus_LastPressed[i] ^ (kb_Data[i]);
-        janus_ReleasedKeys[i] = janus_LastPressed[i] & janus_PressedOrReleasedKeys[i];
-        janus_PressedKeys[i] = (~janus_LastPressed[i]) & janus_PressedOrReleasedKeys[i];
-        
-        // There's probably an easy way to copy the data from kb_Data to this variable
-        // ...but I couldn't find it
-        janus_LastPressed[i] = kb_Data[i];
+bool janus_IsTileSolid(struct janus_TileMap* map, int24_t tileX, int24_t tileY) {
+    if(tileX < 0 || tileY < 0 || tileX >= (int24_t)map->width || tileY >= (int24_t)map->height) {
+        return false;
     }
+    return map->solid[tileY * ((map->width + 7) >> 3) + (tileX >> 3)] & (0x80 >> (tileX & 7));
 }
 
-int24_t janus_GetDeltaTime(void) {
-    static clock_t previousTime;
-    clock_t currentTime = clock();
-    int24_t output = 0;
+/* Like janus_HandleObjectRectCollision, but only pushes through the faces in openFaces */
+static bool janus_PushOutOfTile(struct janus_PhysicsObject* object1, struct janus_Rect* tile, uint8_t openFaces) {
+    int24_t obj1RightWall = object1->rect.position.x + object1->rect.size.x;
+    int24_t tileRightWall = tile->position.x + tile->size.x;
+    int24_t obj1BottomWall = object1->rect.position.y + object1->rect.size.y;
+    int24_t tileBottomWall = tile->position.y + tile->size.y;
 
-    output = (currentTime - previousTime) * 1000 / CLOCKS_PER_SEC;
+    int24_t pushObj1Right = (tileRightWall - object1->rect.position.x);
+    int24_t pushObj1Left = -(obj1RightWall - tile->position.x);
+    int24_t pushObj1Down = (tileBottomWall - object1->rect.position.y);
+    int24_t pushObj1Up = -(obj1BottomWall - tile->position.y);
 
-    previousTime = currentTime;
-    return output;
-}
+    int24_t smallestMovement = janus_SmallestOfFour(
+        (openFaces & JANUS_TILE_FACE_RIGHT) ? JANUS_ABS(pushObj1Right) : JANUS_TILE_CLOSED_FACE,
+        (openFaces & JANUS_TILE_FACE_LEFT) ? JANUS_ABS(pushObj1Left) : JANUS_TILE_CLOSED_FACE,
+        (openFaces & JANUS_TILE_FACE_DOWN) ? JANUS_ABS(pushObj1Down) : JANUS_TILE_CLOSED_FACE,
+        (openFaces & JANUS_TILE_FACE_UP) ? JANUS_ABS(pushObj1Up) : JANUS_TILE_CLOSED_FACE);
 
-int24_t janus_GetFPS(int24_t msElapsed) {
-    return 1000 / msElapsed;
+    if(smallestMovement == JANUS_TILE_CLOSED_FACE) {
+        return false;
+    }
+    if((openFaces & JANUS_TILE_FACE_RIGHT) && smallestMovement == JANUS_ABS(pushObj1Right)) {
+        object1->rect.position.x += pushObj1Right;
+        object1->velocity.x = 0;
+    } else if((openFaces & JANUS_TILE_FACE_LEFT) && smallestMovement == JANUS_ABS(pushObj1Left)) {
+        object1->rect.position.x += pushObj1Left;
+        object1->velocity.x = 0;
+    } else if((openFaces & JANUS_TILE_FACE_UP) && smallestMovement == JANUS_ABS(pushObj1Up)) {
+        object1->rect.position.y += pushObj1Up;
+        object1->velocity.y = 0;
+        return true;
+    } else {
+        object1->rect.position.y += pushObj1Down;
+        object1->velocity.y = 0;
+    }
+    return false;
 }
 
+bool janus_HandleObjectTileMapCollision(struct janus_PhysicsObject* object1, struct janus_TileMap* map) {
+    bool onFloor = false;
+    int24_t firstX, firstY, lastX, lastY, tileX, tileY;
+    struct janus_Rect tile;
 
+    if(object1->rect.size.x <= 0 || object1->rect.size.y <= 0) {
+        return false;
+    }
+    /* Tiles have no mask of their own, so only the object's mask can rule the map out */
+    if(!(JANUS_LAYER_BITS(map->layer) & JANUS_LAYER_BITS(object1->rect.mask))) {
+        return false;
+    }
+    /* Only visit the tiles the object covers */
+    firstX = (object1->rect.position.x - map->position.x) >> map->tileShift;
+    firstY = (object1->rect.position.y - map->position.y) >> map->tileShift;
+    lastX = (object1->rect.position.x + object1->rect.size.x - 1 - map->position.x) >> map->tileShift;
+    lastY = (object1->rect.position.y + object1->rect.size.y - 1 - map->position.y) >> map->tileShift;
+    if(firstX < 0) {
+        firstX = 0;
+    }
+    if(firstY < 0) {
+        firstY = 0;
+    }
+    if(lastX >= (int24_t)map->width) {
+        lastX = map->width - 1;
+    }
+    if(lastY >= (int24_t)map->height) {
+        lastY = map->height - 1;
+    }
 
-//https://easings.net/ for reference
-uint24_t janus_GetEaseProgress(enum janus_EasingMode easingMode, uint24_t alpha) {
-    switch(easingMode) {
-        case LINEAR:
-            return alpha;
-        case QUAD_IN:
-            return JANUS_APPLY_DELTA_TIME(alpha,alpha);
-        case QUAD_OUT:
-            return JANUS_ONE_SECOND - JANUS_APPLY_DELTA_TIME((JANUS_ONE_SECOND - alpha),(JANUS_ONE_SECOND - alpha));
-        case QUAD_IN_OUT:
-            return alpha <= JANUS_ONE_SECOND/2 ? (2 * JANUS_APPLY_DELTA_TIME(alpha,alpha)) : (1000 - JANUS_APPLY_DELTA_TIME((-2 * alpha + 2000),(-2 * alpha + 2000)) / 2);
+    tile.size.x = tile.size.y = 1 << map->tileShift;
+    for(tileY = firstY; tileY <= lastY; tileY++) {
+        for(tileX = firstX; tileX <= lastX; tileX++) {
+            uint8_t openFaces = 0;
+            if(!janus_IsTileSolid(map,tileX,tileY)) {
+                continue;
+            }
+            tile.position.x = map->position.x + (tileX << map->tileShift);
+            tile.position.y = map->position.y + (tileY << map->tileShift);
+            /* The object may already have been pushed clear by an earlier tile */
+            if(!janus_Collision(&object1->rect,&tile)) {
+                continue;
+            }
+            /* Edges shared with another solid tile are seams, not surfaces */
+            if(!janus_IsTileSolid(map,tileX - 1,tileY)) {
+                openFaces |= JANUS_TILE_FACE_LEFT;
+            }
+            if(!janus_IsTileSolid(map,tileX + 1,tileY)) {
+                openFaces |= JANUS_TILE_FACE_RIGHT;
+            }
+            if(!janus_IsTileSolid(map,tileX,tileY - 1)) {
+                openFaces |= JANUS_TILE_FACE_UP;
+            }
+            if(!janus_IsTileSolid(map,tileX,tileY + 1)) {
+                openFaces |= JANUS_TILE_FACE_DOWN;
+            }
+            if(janus_PushOutOfTile(object1,&tile,openFaces)) {
+                onFloor = true;
+            }
+        }
     }
+    return onFloor;
 }
-void janus_UpdateEase(struct janus_Ease* ease, int24_t msElapsed) {
-    int24_t alpha;
 
-    if(msElapsed == 0) {
-        return;
-    }
-    
-    ease->progress = ease->progress + (ease->reverse ? -msElapsed : msElapsed);
-    if(ease->progress > ease->length) {
-        ease->progress = ease->length;
+
+bool janus_RaycastRect(struct janus_Vector2* origin, struct janus_Vector2* ray, struct janus_Rect* rect, struct janus_RayHit* hit) {
+    int24_t entryX, exitX, entryY, exitY, entry, exit;
+
+    /* A ray is a sweep of a rect with no size */
+    if(!janus_SweepAxis(origin->x,0,ray->x,rect->position.x,rect->size.x,&entryX,&exitX)) {
+        return false;
     }
-    if(ease->progress < 0) {
-        ease->progress = 0;
+    if(!janus_SweepAxis(origin->y,0,ray->y,rect->position.y,rect->size.y,&entryY,&exitY)) {
+        return false;
     }
-    alpha = janus_GetEaseProgress(ease->easingMode,ease->progress*1000/ease->length);
-    if(ease->fromX != ease->toX) {
-        ease->currentX = janus_LerpInt24ByInt(ease->fromX,ease->toX,alpha);
-    } else {
-        ease->currentX = ease->toX;
+    entry = entryX > entryY ? entryX : entryY;
+    exit = exitX < exitY ? exitX : exitY;
+    if(entry >= exit || exit <= 0 || entry > JANUS_ONE_SECOND) {
+        return false;
     }
-    if(ease->fromY != ease->toY) {
-        ease->currentY = janus_LerpInt24ByInt(ease->fromY,ease->toY,alpha);
+
+    hit->normal = (struct janus_Vector2){0,0};
+    if(entry < 0) {
+        /* Started inside the rect */
+        hit->position = *origin;
+        hit->distance = 0;
+    } else if(entryX > entryY) {
+        hit->normal.x = ray->x > 0 ? -1 : 1;
+        hit->position.x = ray->x > 0 ? rect->position.x : rect->position.x + rect->size.x;
+        hit->position.y = origin->y + janus_SweepOffset(ray->y,entry);
+        hit->distance = entry;
     } else {
-        ease->currentY = ease->toY;
+        hit->normal.y = ray->y > 0 ? -1 : 1;
+        hit->position.x = origin->x + janus_SweepOffset(ray->x,entry);
+        hit->position.y = ray->y > 0 ? rect->position.y : rect->position.y + rect->size.y;
+        hit->distance = entry;
     }
+    return true;
 }
 
-void janus_UpdateAnimation(struct janus_Animation* animation, int24_t msElapsed) {
-    uint24_t maxLength = 0;
-    animation->msElapsed += msElapsed;
-    if(animation->useVariableTimings) {
-        for(uint24_t i = 0; i < animation->frameCount; i++) {
-            maxLength += animation->frameTimings.variableTimings[i];
+bool janus_RaycastRects(struct janus_Vector2* origin, struct janus_Vector2* ray, struct janus_Rect* rects, uint8_t rectCount, uint8_t mask, struct janus_RayHit* hit) {
+    struct janus_RayHit candidate;
+    uint8_t i;
+    hit->index = -1;
+    mask = JANUS_LAYER_BITS(mask);
+    for(i = 0; i < rectCount; i++) {
+        if(!(JANUS_LAYER_BITS(rects[i].layer) & mask)) {
+            continue;
+        }
+        if(janus_RaycastRect(origin,ray,&rects[i],&candidate) && (hit->index < 0 || candidate.distance < hit->distance)) {
+            *hit = candidate;
+            hit->index = i;
+            if(hit->distance == 0) {
+                break;
+            }
         }
-    } else {
-        maxLength = animation->frameCount * animation->frameTimings.constantTiming;
     }
-    if(animation->msElapsed >= maxLength) {
-        if(animation->loop) {
-            animation->msElapsed -= maxLength;
-        } else {
-            animation->currentFrame = animation->frameCount-1;
-            return;
+    return hit->index >= 0;
+}
+
+uint8_t janus_RaycastRectsBatch(struct janus_Vector2* origin, struct janus_Vector2* rays, uint8_t rayCount, struct janus_Rect* rects, uint8_t rectCount, uint8_t mask, struct janus_RayHit* hits) {
+    struct janus_Rect bounds;
+    struct janus_RayHit candidate;
+    int24_t right = origin->x, bottom = origin->y;
+    uint8_t i, r, hitCount = 0;
+
+    /* Box around every ray so rects nowhere near the fan are skipped with one test */
+    bounds.position = *origin;
+    for(i = 0; i < rayCount; i++) {
+        int24_t endX = origin->x + rays[i].x;
+        int24_t endY = origin->y + rays[i].y;
+        if(endX < bounds.position.x) {
+            bounds.position.x = endX;
+        }
+        if(endX > right) {
+            right = endX;
+        }
+        if(endY < bounds.position.y) {
+            bounds.position.y = endY;
+        }
+        if(endY > bottom) {
+            bottom = endY;
         }
+        hits[i].index = -1;
     }
+    /* Grown by a pixel so rays lying along the edge of the box still count */
+    bounds.position.x--;
+    bounds.position.y--;
+    bounds.size.x = right - bounds.position.x + 2;
+    bounds.size.y = bottom - bounds.position.y + 2;
 
-    if(animation->useVariableTimings) {
-        uint24_t counterMS = 0;
-        for(uint24_t i = 0; i < animation->frameCount; i++) {
-            counterMS += animation->frameTimings.variableTimings[i];
-            if(counterMS >= animation->msElapsed) {
-                animation->currentFrame = i;
-                break;
+    mask = JANUS_LAYER_BITS(mask);
+    for(r = 0; r < rectCount; r++) {
+        if(!(JANUS_LAYER_BITS(rects[r].layer) & mask) || !janus_Collision(&bounds,&rects[r])) {
+            continue;
+        }
+        for(i = 0; i < rayCount; i++) {
+            if(janus_RaycastRect(origin,&rays[i],&rects[r],&candidate) && (hits[i].index < 0 || candidate.distance < hits[i].distance)) {
+                hits[i] = candidate;
+                hits[i].index = r;
             }
         }
-    } else {
-        animation->currentFrame = animation->msElapsed / animation->frameTimings.constantTiming;
     }
-    animation->currentFrame %= animation->frameCount;
-}
-gfx_sprite_t* janus_GetAnimationFrame(struct janus_Animation* animation) {
-    return animation->frames[animation->currentFrame];
+    for(i = 0; i < rayCount; i++) {
+        if(hits[i].index >= 0) {
+            hitCount++;
+        }
+    }
+    return hitCount;
 }
 
+/* Stands in for the crossing time on an axis the ray doesn't move along */
+#define JANUS_RAY_NEVER 0x7FFFFFFF
 
-bool janus_UpdateQuickUI(struct janus_QuickUI* ui) {
-    if(janus_PressedKeys[7] & kb_Down && ui->cursorPosition + 1 != JANUS_QUICKUI_MAX_OPTIONS/2 && ui->cursorPosition + 1 < ui->numberOfOptions) {
-        ui->cursorPosition++;
-    } else if(janus_PressedKeys[7] & kb_Up && ui->cursorPosition - 1 != (JANUS_QUICKUI_MAX_OPTIONS/2) - 1 && ui->cursorPosition > 0 ) {
-        ui->cursorPosition--;
-    } else if(janus_PressedKeys[7] & kb_Right && ui->cursorPosition < JANUS_QUICKUI_MAX_OPTIONS/2 && ui->cursorPosition + JANUS_QUICKUI_MAX_OPTIONS / 2 < ui->numberOfOptions) {
-        ui->cursorPosition += JANUS_QUICKUI_MAX_OPTIONS/2;
-    } else if(janus_PressedKeys[7] & kb_Left && ui->cursorPosition >= JANUS_QUICKUI_MAX_OPTIONS/2) {
-        ui->cursorPosition -= JANUS_QUICKUI_MAX_OPTIONS/2;
+/* Sets up one axis of the tile DDA: which way it steps and how many pixels away the first tile edge is */
+static void janus_SetupRayAxis(int24_t start, int24_t move, uint8_t tileShift, int24_t* step, int24_t* edgeDistance) {
+    int24_t tileStart = (start >> tileShift) << tileShift;
+    if(move > 0) {
+        *step = 1;
+        *edgeDistance = tileStart + (1 << tileShift) - start;
+    } else if(move < 0) {
+        *step = -1;
+        *edgeDistance = start - tileStart;
+    } else {
+        *step = 0;
+        *edgeDistance = 0;
     }
-    if(janus_ReleasedKeys[6] & kb_Enter) {
-        return true;
+}
+
+/* value * time / end for a crossing time no later than end; drops low bits of time and end until the product fits in 32 bits */
+static int32_t janus_ScaleByRayTime(int24_t value, int32_t time, int32_t end) {
+    int32_t limit = 0x7FFFFFFF / ((int32_t)JANUS_ABS(value) + 1);
+    while(end > limit) {
+        time >>= 1;
+        end >>= 1;
     }
-    return false;
+    return value * time / end;
 }
 
-void janus_RenderQuickUI(struct janus_QuickUI* ui) {
-    uint8_t i;
-    uint24_t largestWidthFirstColumn = 0;
+bool janus_RaycastTileMap(struct janus_TileMap* map, struct janus_Vector2* origin, struct janus_Vector2* ray, struct janus_RayHit* hit) {
+    int24_t startX = origin->x - map->position.x;
+    int24_t startY = origin->y - map->position.y;
+    int24_t tileX = startX >> map->tileShift;
+    int24_t tileY = startY >> map->tileShift;
+    int24_t lengthX = JANUS_ABS(ray->x);
+    int24_t lengthY = JANUS_ABS(ray->y);
+    int24_t scaleX = lengthY > 0 ? lengthY : 1;
+    int24_t scaleY = lengthX > 0 ? lengthX : 1;
+    int24_t stepX, stepY, edgeDistanceX, edgeDistanceY;
+    /* Edge crossing times are kept as distance * the other axis' length, so comparing them is exact and stepping is an add */
+    int32_t crossX, crossY, endX, endY, time = 0;
+    int32_t end = (int32_t)scaleX * scaleY;
 
-    gfx_SetTextFGColor(ui->foregroundColor);
-    gfx_SetTextScale(2,2);
-    
-    gfx_PrintStringXY(ui->title,ui->xOffset + JANUS_QUICKUI_PADDING,ui->yOffset + JANUS_QUICKUI_PADDING);
-    
-    gfx_SetTextScale(1,1);
-    for(i = 0; i < ui->numberOfOptions; i++) {
-        uint24_t x,w;
-        uint8_t y,h;
-        bool selecting;
-        w = gfx_GetStringWidth(ui -> options[i])+(JANUS_QUICKUI_PADDING*2);
-        h = JANUS_QUICKUI_BUTTON_HEIGHT;
-        y = ui->yOffset + JANUS_QUICKUI_PADDING + JANUS_QUICKUI_BUTTONS_Y_OFFSET + ((h+JANUS_QUICKUI_PADDING) * (i % (JANUS_QUICKUI_MAX_OPTIONS/2)));
-        /* UI Layout Styles*/
-        if(ui->layoutStyle == STACK) {
-            x = ui->xOffset + JANUS_QUICKUI_PADDING + ((i < JANUS_QUICKUI_MAX_OPTIONS/2) ? 0 : gfx_GetStringWidth(ui->options[i-(JANUS_QUICKUI_MAX_OPTIONS/2)]) + JANUS_QUICKUI_PADDING*4);
-        } else if(ui->layoutStyle == UNIFORM) {
-            x = ui->xOffset + JANUS_QUICKUI_PADDING + ((i < JANUS_QUICKUI_MAX_OPTIONS/2) ? 0 : largestWidthFirstColumn + (JANUS_QUICKUI_PADDING*4));
-        } else if(ui->layoutStyle == ELASTIC) {
-            x = ui->xOffset + JANUS_QUICKUI_PADDING;
-            if(i >= JANUS_QUICKUI_MAX_OPTIONS/2) {
-                uint24_t avg = 0;
-                uint8_t j;
-                for(j = janus_Max(i-1,JANUS_QUICKUI_MAX_OPTIONS/2); j <= janus_Min(i + 1,JANUS_QUICKUI_MAX_OPTIONS-1); j++) {
-                    avg += gfx_GetStringWidth(ui->options[j-(JANUS_QUICKUI_MAX_OPTIONS/2)]);
-                }
-                x += avg/3 + largestWidthFirstColumn/2 + (JANUS_QUICKUI_PADDING*4);
+    janus_SetupRayAxis(startX,ray->x,map->tileShift,&stepX,&edgeDistanceX);
+    janus_SetupRayAxis(startY,ray->y,map->tileShift,&stepY,&edgeDistanceY);
+    crossX = stepX != 0 ? (int32_t)edgeDistanceX * scaleX : JANUS_RAY_NEVER;
+    crossY = stepY != 0 ? (int32_t)edgeDistanceY * scaleY : JANUS_RAY_NEVER;
+    /* A ray ending exactly on a tile edge only reaches the next tile when moving in the positive direction */
+    endX = end - (stepX < 0 ? 1 : 0);
+    endY = end - (stepY < 0 ? 1 : 0);
+    hit->normal = (struct janus_Vector2){0,0};
+    hit->index = -1;
+
+    /* Step into whichever neighbouring tile the ray reaches first until a solid one turns up.
+       Through an exact corner, an edge crossed in the positive direction is entered first (the corner belongs to that tile), and two such edges are crossed together. */
+    while(!janus_IsTileSolid(map,tileX,tileY)) {
+        if(crossX == crossY && stepX == stepY && stepX != 0) {
+            if(crossX > endX) {
+                return false;
             }
+            time = crossX;
+            crossX += (int32_t)scaleX << map->tileShift;
+            crossY += (int32_t)scaleY << map->tileShift;
+            tileX += stepX;
+            tileY += stepY;
+            hit->normal = (struct janus_Vector2){0,-stepY};
+        } else if(crossX < crossY || (crossX == crossY && stepX > 0)) {
+            if(crossX > endX) {
+                return false;
+            }
+            time = crossX;
+            crossX += (int32_t)scaleX << map->tileShift;
+            tileX += stepX;
+            hit->normal = (struct janus_Vector2){-stepX,0};
+        } else {
+            if(crossY > endY) {
+                return false;
+            }
+            time = crossY;
+            crossY += (int32_t)scaleY << map->tileShift;
+            tileY += stepY;
+            hit->normal = (struct janus_Vector2){0,-stepY};
         }
-        /* End UI Layout Styles */
-        if(i < JANUS_QUICKUI_MAX_OPTIONS/2 && w > largestWidthFirstColumn && ui->layoutStyle != STACK) {
-            largestWidthFirstColumn = w;
+    }
+
+    hit->index = tileY * map->width + tileX;
+    if(end == 0 || time == 0) {
+        hit->distance = 0;
+        hit->position = *origin;
+    } else {
+        /* Times reach |ray->x| * |ray->y|, so multiplying them by anything else has to be kept from overflowing */
+        hit->distance = janus_ScaleByRayTime(JANUS_ONE_SECOND,time,end);
+        hit->position.x = origin->x + (int24_t)janus_ScaleByRayTime(ray->x,time,end);
+        hit->position.y = origin->y + (int24_t)janus_ScaleByRayTime(ray->y,time,end);
+    }
+    /* Snap to the edge that was crossed so rounding can't put the point inside the wrong tile */
+    if(hit->normal.x != 0) {
+        hit->position.x = map->position.x + ((tileX + (stepX < 0 ? 1 : 0)) << map->tileShift);
+    } else if(hit->normal.y != 0) {
+        hit->position.y = map->position.y + ((tileY + (stepY < 0 ? 1 : 0)) << map->tileShift);
+    }
+    return true;
+}
+
+uint8_t janus_RaycastTileMapBatch(struct janus_TileMap* map, struct janus_Vector2* origin, struct janus_Vector2* rays, uint8_t rayCount, struct janus_RayHit* hits) {
+    uint8_t i, hitCount = 0;
+    for(i = 0; i < rayCount; i++) {
+        if(janus_RaycastTileMap(map,origin,&rays[i],&hits[i])) {
+            hitCount++;
         }
+    }
+    return hitCount;
+}
+
+
+void janus_AddForce(struct janus_PhysicsObject* object, struct janus_Vector2* velocity) { 
+    object->velocity = janus_AddVectors(&object->velocity,velocity);
+}
+
+void janus_DampenVelocity(struct janus_PhysicsObject* object, struct janus_Vector2* dampen) {
+    struct janus_Vector2 divided = janus_DivideVectors(&object->velocity,dampen);
+    object->velocity = janus_SubtractVectors(&object->velocity,&divided);
+}
+
+void janus_ApplyVelocity(struct janus_PhysicsObject* object, int24_t deltaMS) {
+    object->previousPosition = object->rect.position;
+    struct janus_Vector2 delta = (struct janus_Vector2){JANUS_APPLY_DELTA_TIME(object->velocity.x,deltaMS),JANUS_APPLY_DELTA_TIME(object->velocity.y,deltaMS)};
+    object->rect.position = janus_AddVectors(&object->rect.position,&delta);
+    object->velocity = janus_SubtractVectors(&object->velocity,&delta);
+}
+
+
+/* 4096 / n, so a resistance ratio is a multiply and a shift instead of a divide */
+static const uint16_t janus_ResistanceReciprocals[JANUS_FIXED_MAX_RESISTANCE * 2 + 1] = {
+    0, 4096, 2048, 1365, 1024, 819, 683, 585, 512, 455, 410, 372, 341, 315, 293, 273,
+    256, 241, 228, 216, 205, 195, 186, 178, 171, 164, 158, 152, 146, 141, 137
+};
+
+/* Returns value * factor >> shift, rounding toward zero so small negative values settle like positive ones */
+static int24_t janus_ScaleFixed(int24_t value, int24_t factor, uint8_t shift) {
+    int32_t scaled = ((int32_t)JANUS_ABS(value) * factor) >> shift;
+    return value < 0 ? -scaled : scaled;
+}
+
+/* Pushes two fixed point objects apart by push along one axis, split by influence */
+static void janus_SplitFixedPush(int24_t push, int24_t object1Influence, int24_t object2Influence, int24_t* amt1, int24_t* amt2) {
+    if(object2Influence == 0) {
+        *amt1 = push;
+        *amt2 = 0;
+    } else if(object1Influence == 0) {
+        *amt1 = 0;
+        *amt2 = push;
+    } else {
+        *amt1 = janus_ScaleFixed(push,object1Influence * janus_ResistanceReciprocals[object1Influence + object2Influence],JANUS_FIXED_RECIPROCAL_SHIFT);
+        *amt2 = push - *amt1;
+    }
+}
+
+bool janus_HandleFixedObjectObjectCollision(struct janus_FixedPhysicsObject* object1, struct janus_FixedPhysicsObject* object2) {
+    bool onFloor = false;
+    int24_t object1Influence, object2Influence, amt1, amt2;
+    if(!janus_LayersCollide(&object1->rect,&object2->rect) || !janus_Collision(&object1->rect,&object2->rect)) {
+        return false;
+    }
+    /* Clamped so the pair always stays inside janus_ResistanceReciprocals */
+    object1Influence = object1->anchored ? 0 : janus_Min(object1->resistance,JANUS_FIXED_MAX_RESISTANCE);
+    object2Influence = object2->anchored ? 0 : janus_Min(object2->resistance,JANUS_FIXED_MAX_RESISTANCE);
+    if(object1Influence == 0 && object2Influence == 0) {
+        return false;
+    }
+
+    int24_t obj1RightWall = object1->rect.position.x + object1->rect.size.x;
+    int24_t obj2RightWall = object2->rect.position.x + object2->rect.size.x;
+    int24_t obj1BottomWall = object1->rect.position.y + object1->rect.size.y;
+    int24_t obj2BottomWall = object2->rect.position.y + object2->rect.size.y;
+    
+    int24_t pushObj1Right = (obj2RightWall - object1->rect.position.x);
+    int24_t pushObj1Left = -(obj1RightWall - object2->rect.position.x);
+    int24_t pushObj1Down = (obj2BottomWall - object1->rect.position.y);
+    int24_t pushObj1Up = -(obj1BottomWall - object2->rect.position.y);
+
+    int24_t smallestMovement = janus_SmallestOfFour(JANUS_ABS(pushObj1Right),JANUS_ABS(pushObj1Left),JANUS_ABS(pushObj1Down),JANUS_ABS(pushObj1Up));
+
+    if(smallestMovement == JANUS_ABS(pushObj1Right) || smallestMovement == JANUS_ABS(pushObj1Left)) {
+        janus_SplitFixedPush(smallestMovement == JANUS_ABS(pushObj1Right) ? pushObj1Right : pushObj1Left,object1Influence,object2Influence,&amt1,&amt2);
+        object1->rect.position.x += amt1;
+        object2->rect.position.x -= amt2;
+        object1->velocity.x -= ((object1->velocity.x) < 0 ? -1 : 0) * janus_Min(JANUS_ABS(amt1),JANUS_ABS(object1->velocity.x));
+        object2->velocity.x -= ((object2->velocity.x) < 0 ? -1 : 0) * janus_Min(JANUS_ABS(amt2),JANUS_ABS(object2->velocity.x));
+    } else {
+        onFloor = smallestMovement == JANUS_ABS(pushObj1Up);
+        janus_SplitFixedPush(onFloor ? pushObj1Up : pushObj1Down,object1Influence,object2Influence,&amt1,&amt2);
+        object1->rect.position.y += amt1;
+        object2->rect.position.y -= amt2;
+        object1->velocity.y -= ((object1->velocity.y) < 0 ? -1 : 0) * janus_Min(JANUS_ABS(amt1),JANUS_ABS(object1->velocity.y));
+        object2->velocity.y -= ((object2->velocity.y) < 0 ? -1 : 0) * janus_Min(JANUS_ABS(amt2),JANUS_ABS(object2->velocity.y));
+    }
+    return onFloor;
+}
+
+bool janus_HandleFixedObjectRectCollision(struct janus_FixedPhysicsObject* object1, struct janus_Rect* rect) {
+    /* Positions are already fixed point, so this is the same push out as janus_HandleObjectRectCollision */
+    struct janus_PhysicsObject object = {.rect = object1->rect, .velocity = object1->velocity};
+    bool onFloor = janus_HandleObjectRectCollision(&object,rect);
+    object1->rect = object.rect;
+    object1->velocity = object.velocity;
+    return onFloor;
+}
+
+void janus_AddFixedForce(struct janus_FixedPhysicsObject* object, struct janus_Vector2* velocity) {
+    object->velocity.x += velocity->x;
+    object->velocity.y += velocity->y;
+}
+
+void janus_ApplyFixedVelocity(struct janus_FixedPhysicsObject* object, int24_t deltaMS) {
+    int24_t deltaX = janus_ScaleFixed(object->velocity.x,deltaMS,JANUS_FIXED_TIME_SHIFT);
+    int24_t deltaY = janus_ScaleFixed(object->velocity.y,deltaMS,JANUS_FIXED_TIME_SHIFT);
+    object->rect.position.x += deltaX;
+    object->rect.position.y += deltaY;
+    object->velocity.x -= deltaX;
+    object->velocity.y -= deltaY;
+}
+
+void janus_DampenFixedVelocity(struct janus_FixedPhysicsObject* object, struct janus_Vector2* keep) {
+    object->velocity.x = janus_ScaleFixed(object->velocity.x,keep->x,JANUS_FIXED_SHIFT);
+    object->velocity.y = janus_ScaleFixed(object->velocity.y,keep->y,JANUS_FIXED_SHIFT);
+}
+
+
+void janus_InitWorld(struct janus_PhysicsWorld* world) {
+    memset(world,0,sizeof(struct janus_PhysicsWorld));
+    world->rectsChanged = true;
+}
+
+struct janus_PhysicsObject* janus_AddWorldObject(struct janus_PhysicsWorld* world, struct janus_PhysicsObject* object) {
+    if(world->objectCount >= JANUS_PHYSICS_MAX_OBJECTS) {
+        return NULL;
+    }
+    world->objects[world->objectCount] = *object;
+    world->onFloor[world->objectCount] = false;
+    world->islands[world->objectCount] = world->objectCount;
+    return &world->objects[world->objectCount++];
+}
+
+struct janus_Rect* janus_AddWorldRect(struct janus_PhysicsWorld* world, struct janus_Rect* rect) {
+    if(world->rectCount >= JANUS_PHYSICS_MAX_RECTS) {
+        return NULL;
+    }
+    world->rects[world->rectCount] = *rect;
+    world->rectsChanged = true;
+    return &world->rects[world->rectCount++];
+}
+
+static uint24_t janus_HashCell(int24_t cellX, int24_t cellY) {
+    const int24_t mask = (1 << JANUS_PHYSICS_GRID_BITS) - 1;
+    return (cellX & mask) | ((cellY & mask) << JANUS_PHYSICS_GRID_BITS);
+}
+
+/* Gets the inclusive range of cells a rect covers; returns false for empty rects */
+static bool janus_GetCellRange(struct janus_Rect* rect, struct janus_Rect* cells) {
+    if(rect->size.x <= 0 || rect->size.y <= 0) {
+        return false;
+    }
+    cells->position.x = rect->position.x >> JANUS_PHYSICS_CELL_SHIFT;
+    cells->position.y = rect->position.y >> JANUS_PHYSICS_CELL_SHIFT;
+    cells->size.x = (rect->position.x + rect->size.x - 1) >> JANUS_PHYSICS_CELL_SHIFT;
+    cells->size.y = (rect->position.y + rect->size.y - 1) >> JANUS_PHYSICS_CELL_SHIFT;
+    return true;
+}
+
+/* Links a rect into every bucket it covers; returns false if it is too big to bucket and should be tested against everything instead */
+static bool janus_InsertIntoGrid(struct janus_Rect* rect, uint8_t index, uint16_t* buckets, struct janus_CellEntry* entries, uint24_t* entryCount, uint24_t maxEntries) {
+    struct janus_Rect cells;
+    int24_t cellX, cellY;
+    if(!janus_GetCellRange(rect,&cells)) {
+        return true;
+    }
+    if(cells.size.x - cells.position.x >= (1 << JANUS_PHYSICS_GRID_BITS) || cells.size.y - cells.position.y >= (1 << JANUS_PHYSICS_GRID_BITS)) {
+        return false;
+    }
+    if(*entryCount + (cells.size.x - cells.position.x + 1) * (cells.size.y - cells.position.y + 1) > maxEntries) {
+        return false;
+    }
+    for(cellY = cells.position.y; cellY <= cells.size.y; cellY++) {
+        for(cellX = cells.position.x; cellX <= cells.size.x; cellX++) {
+            uint24_t bucket = janus_HashCell(cellX,cellY);
+            entries[*entryCount].index = index;
+            entries[*entryCount].next = buckets[bucket];
+            buckets[bucket] = *entryCount;
+            (*entryCount)++;
+        }
+    }
+    return true;
+}
+
+static void janus_RebuildStaticGrid(struct janus_PhysicsWorld* world) {
+    uint24_t entryCount = 0;
+    uint8_t i;
+    memset(world->staticBuckets,0xFF,sizeof(world->staticBuckets));
+    world->overflowRectCount = 0;
+    for(i = 0; i < world->rectCount; i++) {
+        if(!janus_InsertIntoGrid(&world->rects[i],i,world->staticBuckets,world->staticEntries,&entryCount,JANUS_PHYSICS_MAX_STATIC_ENTRIES)) {
+            world->overflowRects[world->overflowRectCount++] = i;
+        }
+    }
+    world->rectsChanged = false;
+}
+
+/* Resolves objects[i] against objects[j] and marks whichever one ended up on top; onFloor may be NULL */
+static uint8_t janus_ResolveObjectPair(struct janus_PhysicsObject* objects, bool* onFloor, uint8_t i, uint8_t j) {
+    uint8_t contact;
+    if(objects[i].anchored && objects[j].anchored) {
+        return JANUS_CONTACT_NONE;
+    }
+    contact = janus_ResolveObjectObjectCollision(&objects[i],&objects[j]);
+    if(onFloor == NULL) {
+        return contact;
+    }
+    if(contact == JANUS_CONTACT_ON_TOP) {
+        onFloor[i] = true;
+    } else if(contact == JANUS_CONTACT_BELOW) {
+        onFloor[j] = true;
+    }
+    return contact;
+}
+
+/* Finds the first object of an island, flattening the path as it goes */
+static uint8_t janus_FindIsland(struct janus_PhysicsWorld* world, uint8_t i) {
+    while(world->islands[i] != i) {
+        world->islands[i] = world->islands[world->islands[i]];
+        i = world->islands[i];
+    }
+    return i;
+}
+
+void janus_WakeWorldObject(struct janus_PhysicsWorld* world, uint8_t index) {
+    uint8_t island, i;
+    if(!world->objects[index].sleeping) {
+        return;
+    }
+    island = janus_FindIsland(world,index);
+    for(i = 0; i < world->objectCount; i++) {
+        if(world->objects[i].sleeping && janus_FindIsland(world,i) == island) {
+            world->objects[i].sleeping = false;
+            world->objects[i].stillFrames = 0;
+        }
+    }
+}
+
+/* Resolves a pair, waking a sleeping island that gets hit and joining the islands of anything touching */
+static void janus_ResolveWorldPair(struct janus_PhysicsWorld* world, uint8_t i, uint8_t j) {
+    /* Filter on layers before doing any real work */
+    if(!janus_LayersCollide(&world->objects[i].rect,&world->objects[j].rect)) {
+        return;
+    }
+    if(world->objects[i].trigger || world->objects[j].trigger) {
+        if(world->triggerEventCount < JANUS_PHYSICS_MAX_TRIGGER_EVENTS && janus_Collision(&world->objects[i].rect,&world->objects[j].rect)) {
+            world->triggerEvents[world->triggerEventCount].object1 = i;
+            world->triggerEvents[world->triggerEventCount].object2 = j;
+            world->triggerEventCount++;
+        }
+        return;
+    }
+    if(world->objects[i].sleeping || world->objects[j].sleeping) {
+        if(world->objects[i].sleeping == world->objects[j].sleeping || !janus_Collision(&world->objects[i].rect,&world->objects[j].rect)) {
+            return;
+        }
+        janus_WakeWorldObject(world,i);
+        janus_WakeWorldObject(world,j);
+    }
+    if(janus_ResolveObjectPair(world->objects,world->onFloor,i,j) != JANUS_CONTACT_NONE) {
+        world->islands[janus_FindIsland(world,i)] = janus_FindIsland(world,j);
+    }
+}
+
+void janus_StepWorld(struct janus_PhysicsWorld* world, int24_t deltaMS) {
+    uint8_t visitedObjects[JANUS_PHYSICS_MAX_OBJECTS];
+    uint8_t visitedRects[JANUS_PHYSICS_MAX_RECTS];
+    bool overflow[JANUS_PHYSICS_MAX_OBJECTS];
+    bool islandStill[JANUS_PHYSICS_MAX_OBJECTS];
+    uint24_t entryCount = 0;
+    uint8_t i, j;
+
+    if(world->rectsChanged) {
+        janus_RebuildStaticGrid(world);
+        /* Whatever was resting on a moved rect needs to notice, and has to count its stillness again from scratch */
+        for(i = 0; i < world->objectCount; i++) {
+            world->objects[i].sleeping = false;
+            world->objects[i].stillFrames = 0;
+        }
+    }
+    memset(visitedRects,0xFF,sizeof(visitedRects));
+    world->triggerEventCount = 0;
+
+    /* Sleeping objects that were pushed or jumped since the last step wake up with their island */
+    for(i = 0; i < world->objectCount; i++) {
+        if(world->objects[i].sleeping && (world->objects[i].velocity.x != 0 || world->objects[i].velocity.y != 0)) {
+            janus_WakeWorldObject(world,i);
+        }
+    }
+    /* Awake objects start this step in an island of their own */
+    for(i = 0; i < world->objectCount; i++) {
+        if(!world->objects[i].sleeping) {
+            world->islands[i] = i;
+        }
+    }
+
+    /* Integrate, then resolve each object against the static rects sharing its cells */
+    for(i = 0; i < world->objectCount; i++) {
+        struct janus_PhysicsObject* object = &world->objects[i];
+        struct janus_Rect cells;
+        int24_t cellX, cellY;
+
+        object->previousPosition = object->rect.position;
+        if(object->sleeping) {
+            continue;
+        }
+        janus_ApplyVelocity(object,deltaMS);
+        if(!object->anchored) {
+            janus_AddForce(object,&world->gravity);
+        }
+        world->onFloor[i] = false;
+
+        if(janus_GetCellRange(&object->rect,&cells)) {
+            for(cellY = cells.position.y; cellY <= cells.size.y; cellY++) {
+                for(cellX = cells.position.x; cellX <= cells.size.x; cellX++) {
+                    uint16_t entry;
+                    for(entry = world->staticBuckets[janus_HashCell(cellX,cellY)]; entry != JANUS_PHYSICS_NO_ENTRY; entry = world->staticEntries[entry].next) {
+                        uint8_t r = world->staticEntries[entry].index;
+                        if(visitedRects[r] == i) {
+                            continue;
+                        }
+                        visitedRects[r] = i;
+                        if(janus_HandleObjectRectCollision(object,&world->rects[r])) {
+                            world->onFloor[i] = true;
+                        }
+                    }
+                }
+            }
+        }
+        for(j = 0; j < world->overflowRectCount; j++) {
+            if(janus_HandleObjectRectCollision(object,&world->rects[world->overflowRects[j]])) {
+                world->onFloor[i] = true;
+            }
+        }
+    }
+
+    /* Bucket the objects where they ended up */
+    memset(world->buckets,0xFF,sizeof(world->buckets));
+    world->overflowObjectCount = 0;
+    for(i = 0; i < world->objectCount; i++) {
+        overflow[i] = !janus_InsertIntoGrid(&world->objects[i].rect,i,world->buckets,world->entries,&entryCount,JANUS_PHYSICS_MAX_CELL_ENTRIES);
+        if(overflow[i]) {
+            world->overflowObjects[world->overflowObjectCount++] = i;
+        }
+        visitedObjects[i] = 0xFF;
+    }
+
+    /* Resolve each pair that shares a cell once, with the lower index as object1 */
+    for(i = 0; i < world->objectCount; i++) {
+        struct janus_Rect cells;
+        int24_t cellX, cellY;
+        if(overflow[i] || !janus_GetCellRange(&world->objects[i].rect,&cells)) {
+            continue;
+        }
+        for(cellY = cells.position.y; cellY <= cells.size.y; cellY++) {
+            for(cellX = cells.position.x; cellX <= cells.size.x; cellX++) {
+                uint16_t entry;
+                for(entry = world->buckets[janus_HashCell(cellX,cellY)]; entry != JANUS_PHYSICS_NO_ENTRY; entry = world->entries[entry].next) {
+                    j = world->entries[entry].index;
+                    if(j <= i || visitedObjects[j] == i) {
+                        continue;
+                    }
+                    visitedObjects[j] = i;
+                    janus_ResolveWorldPair(world,i,j);
+                }
+            }
+        }
+    }
+    /* Objects too big for the grid are tested against everything */
+    for(i = 0; i < world->overflowObjectCount; i++) {
+        uint8_t o = world->overflowObjects[i];
+        for(j = 0; j < world->objectCount; j++) {
+            if(j == o || (overflow[j] && j < o)) {
+                continue;
+            }
+            if(j < o) {
+                janus_ResolveWorldPair(world,j,o);
+            } else {
+                janus_ResolveWorldPair(world,o,j);
+            }
+        }
+    }
+
+    for(i = 0; i < world->objectCount; i++) {
+        struct janus_PhysicsObject* object = &world->objects[i];
+        if(object->sleeping) {
+            continue;
+        }
+        if(world->dampen.x != 0) {
+            object->velocity.x -= object->velocity.x / world->dampen.x;
+        }
+        if(world->dampen.y != 0) {
+            object->velocity.y -= object->velocity.y / world->dampen.y;
+        }
+        /* Resting objects sink a pixel and get pushed back out, so judge stillness by how far they actually moved */
+        if(JANUS_ABS(object->rect.position.x - object->previousPosition.x) <= JANUS_SLEEP_DISTANCE && JANUS_ABS(object->rect.position.y - object->previousPosition.y) <= JANUS_SLEEP_DISTANCE) {
+            if(object->stillFrames < JANUS_SLEEP_FRAMES) {
+                object->stillFrames++;
+            }
+        } else {
+            object->stillFrames = 0;
+        }
+    }
+
+    /* An island only sleeps once every object in it has been still for long enough */
+    for(i = 0; i < world->objectCount; i++) {
+        islandStill[i] = true;
+    }
+    for(i = 0; i < world->objectCount; i++) {
+        if(!world->objects[i].sleeping && world->objects[i].stillFrames < JANUS_SLEEP_FRAMES) {
+            islandStill[janus_FindIsland(world,i)] = false;
+        }
+    }
+    world->sleepingCount = 0;
+    for(i = 0; i < world->objectCount; i++) {
+        struct janus_PhysicsObject* object = &world->objects[i];
+        if(!object->sleeping && islandStill[janus_FindIsland(world,i)]) {
+            object->sleeping = true;
+            object->velocity = (struct janus_Vector2){0,0};
+            /* Something has to be holding it up against gravity; keep it jumpable while it sleeps */
+            if(world->gravity.y > 0 && !object->anchored) {
+                world->onFloor[i] = true;
+            }
+        }
+        if(object->sleeping) {
+            world->sleepingCount++;
+        }
+    }
+    world->awakeCount = world->objectCount - world->sleepingCount;
+}
+
+
+uint8_t janus_AccumulateTimestep(struct janus_Timestep* timestep, int24_t deltaMS) {
+    uint8_t steps = 0;
+    if(timestep->stepMS <= 0) {
+        /* No step length to divide time into; run nothing rather than divide by zero */
+        timestep->alpha = 0;
+        return 0;
+    }
+    timestep->accumulator += deltaMS;
+    while(timestep->accumulator >= timestep->stepMS && steps < timestep->maxSteps) {
+        timestep->accumulator -= timestep->stepMS;
+        steps++;
+    }
+    /* Drop whole steps we couldn't catch up on, but keep the fraction so motion stays smooth */
+    if(timestep->accumulator >= timestep->stepMS) {
+        timestep->accumulator %= timestep->stepMS;
+    }
+    timestep->alpha = timestep->accumulator * JANUS_ONE_SECOND / timestep->stepMS;
+    return steps;
+}
+
+void janus_StepWorldTimestep(struct janus_PhysicsWorld* world, struct janus_Timestep* timestep, int24_t deltaMS) {
+    uint8_t steps = janus_AccumulateTimestep(timestep,deltaMS);
+    while(steps > 0) {
+        janus_StepWorld(world,timestep->stepMS);
+        steps--;
+    }
+}
+
+struct janus_Vector2 janus_GetInterpolatedPosition(struct janus_PhysicsObject* object, int24_t alpha) {
+    return (struct janus_Vector2){janus_LerpInt24ByInt(object->previousPosition.x,object->rect.position.x,alpha),janus_LerpInt24ByInt(object->previousPosition.y,object->rect.position.y,alpha)};
+}
+
+void janus_SetBatchObject(struct janus_PhysicsBatch* batch, uint8_t index, struct janus_PhysicsObject* object) {
+    batch->x[index] = object->rect.position.x;
+    batch->y[index] = object->rect.position.y;
+    batch->width[index] = object->rect.size.x;
+    batch->height[index] = object->rect.size.y;
+    batch->velocityX[index] = object->velocity.x;
+    batch->velocityY[index] = object->velocity.y;
+    batch->resistance[index] = object->resistance;
+    if(object->anchored) {
+        batch->anchored[index >> 3] |= 1 << (index & 7);
+    } else {
+        batch->anchored[index >> 3] &= ~(1 << (index & 7));
+    }
+}
+
+void janus_GetBatchObject(struct janus_PhysicsBatch* batch, uint8_t index, struct janus_PhysicsObject* object) {
+    object->rect.position.x = batch->x[index];
+    object->rect.position.y = batch->y[index];
+    object->rect.size.x = batch->width[index];
+    object->rect.size.y = batch->height[index];
+    object->velocity.x = batch->velocityX[index];
+    object->velocity.y = batch->velocityY[index];
+    object->resistance = batch->resistance[index];
+    object->anchored = batch->anchored[index >> 3] & (1 << (index & 7));
+}
+
+void janus_StepPhysicsBatch(struct janus_PhysicsBatch* batch, struct janus_Vector2* gravity, struct janus_Vector2* dampen, int24_t deltaMS) {
+    /* Pull everything into locals so the loop body only touches the arrays */
+    int24_t* restrict x = batch->x;
+    int24_t* restrict y = batch->y;
+    int24_t* restrict velocityX = batch->velocityX;
+    int24_t* restrict velocityY = batch->velocityY;
+    const uint8_t* anchored = batch->anchored;
+    const int24_t gravityX = gravity->x;
+    const int24_t gravityY = gravity->y;
+    const int24_t dampenX = dampen->x;
+    const int24_t dampenY = dampen->y;
+    const uint8_t count = batch->count;
+    uint8_t i;
+
+    for(i = 0; i < count; i++) {
+        int24_t vx, vy, deltaX, deltaY;
+        if(anchored[i >> 3] & (1 << (i & 7))) {
+            continue;
+        }
+        vx = velocityX[i];
+        vy = velocityY[i];
+        /* janus_ApplyVelocity */
+        deltaX = JANUS_APPLY_DELTA_TIME(vx,deltaMS);
+        deltaY = JANUS_APPLY_DELTA_TIME(vy,deltaMS);
+        x[i] += deltaX;
+        y[i] += deltaY;
+        /* janus_AddForce */
+        vx += gravityX - deltaX;
+        vy += gravityY - deltaY;
+        /* janus_DampenVelocity */
+        if(dampenX != 0) {
+            vx -= vx / dampenX;
+        }
+        if(dampenY != 0) {
+            vy -= vy / dampenY;
+        }
+        velocityX[i] = vx;
+        velocityY[i] = vy;
+    }
+}
+
+void janus_InitSweepAndPrune(struct janus_SweepAndPrune* sap, struct janus_PhysicsObject* objects, uint8_t objectCount) {
+    sap->objects = objects;
+    sap->objectCount = objectCount;
+    sap->sortedCount = 0;
+    sap->pairCount = 0;
+    sap->pairsTested = 0;
+    sap->pairsOverlapping = 0;
+}
+
+void janus_UpdateSweepAndPrune(struct janus_SweepAndPrune* sap) {
+    uint8_t i, j;
+
+    if(sap->sortedCount != sap->objectCount) {
+        for(i = 0; i < sap->objectCount; i++) {
+            sap->endpoints[i].index = i;
+        }
+        sap->sortedCount = sap->objectCount;
+    }
+
+    /* Refresh the cached edges; the order from last update is kept */
+    for(i = 0; i < sap->sortedCount; i++) {
+        struct janus_Rect* rect = &sap->objects[sap->endpoints[i].index].rect;
+        sap->endpoints[i].minX = rect->position.x;
+        sap->endpoints[i].maxX = rect->position.x + rect->size.x;
+    }
+
+    /* Insertion sort; objects only move a few pixels a frame, so this is close to one pass */
+    for(i = 1; i < sap->sortedCount; i++) {
+        struct janus_SweepEndpoint endpoint = sap->endpoints[i];
+        j = i;
+        while(j > 0 && sap->endpoints[j-1].minX > endpoint.minX) {
+            sap->endpoints[j] = sap->endpoints[j-1];
+            j--;
+        }
+        sap->endpoints[j] = endpoint;
+    }
+
+    /* Sweep; everything after i that starts before i ends overlaps on X */
+    sap->pairCount = 0;
+    sap->pairsTested = 0;
+    sap->pairsOverlapping = 0;
+    for(i = 0; i < sap->sortedCount; i++) {
+        for(j = i + 1; j < sap->sortedCount && sap->endpoints[j].minX < sap->endpoints[i].maxX; j++) {
+            uint8_t object1 = sap->endpoints[i].index;
+            uint8_t object2 = sap->endpoints[j].index;
+            sap->pairsTested++;
+            if(!janus_Collision(&sap->objects[object1].rect,&sap->objects[object2].rect)) {
+                continue;
+            }
+            sap->pairsOverlapping++;
+            if(sap->pairCount < JANUS_SAP_MAX_PAIRS) {
+                sap->pairs[sap->pairCount].object1 = object1;
+                sap->pairs[sap->pairCount].object2 = object2;
+                sap->pairCount++;
+            }
+        }
+    }
+}
+
+void janus_HandleSweepAndPruneCollisions(struct janus_SweepAndPrune* sap, bool* onFloor) {
+    uint24_t i;
+    for(i = 0; i < sap->pairCount; i++) {
+        janus_ResolveObjectPair(sap->objects,onFloor,sap->pairs[i].object1,sap->pairs[i].object2);
+    }
+}
+
+
+/* Current JANUS_TIMER_NUMBER tick count; CPU cycles on the calculator, microseconds on a PC */
+static uint32_t janus_GetTimerTicks(void) {
+#ifdef __TICE__
+    return timer_Get(JANUS_TIMER_NUMBER);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC,&now);
+    return (uint32_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
+/* Starts JANUS_TIMER_NUMBER counting CPU cycles if it isn't already; nothing to do on a PC */
+static void janus_StartTimer(void) {
+#ifdef __TICE__
+    static bool started = false;
+    if(!started) {
+        timer_Disable(JANUS_TIMER_NUMBER);
+        timer_Set(JANUS_TIMER_NUMBER,0);
+        timer_Enable(JANUS_TIMER_NUMBER,TIMER_CPU,TIMER_NOINT,JANUS_TIMER_DIRECTION);
+        started = true;
+    }
+#endif
+}
+
+#if JANUS_PROFILER
+void janus_InitProfiler(void) {
+    memset(&janus_Profiler,0,sizeof(struct janus_Profiler));
+    janus_StartTimer();
+}
+void janus_NameProfilerZone(uint8_t zone, const char* name) {
+    janus_Profiler.zones[zone].name = name;
+}
+void janus_BeginProfilerZone(uint8_t zone) {
+    janus_Profiler.zones[zone].start = janus_GetTimerTicks();
+}
+void janus_EndProfilerZone(uint8_t zone) {
+    /* Unsigned subtraction keeps working when the counter wraps */
+    janus_Profiler.zones[zone].frameTicks += janus_GetTimerTicks() - janus_Profiler.zones[zone].start;
+}
+void janus_EndProfilerFrame(void) {
+    uint8_t zone;
+    for(zone = 0; zone < JANUS_PROFILER_MAX_ZONES; zone++) {
+        janus_Profiler.history[janus_Profiler.historyHead][zone] = janus_Profiler.zones[zone].frameTicks;
+        janus_Profiler.zones[zone].frameTicks = 0;
+    }
+    if(++janus_Profiler.historyHead == JANUS_PROFILER_HISTORY) {
+        janus_Profiler.historyHead = 0;
+    }
+    if(janus_Profiler.historyCount < JANUS_PROFILER_HISTORY) {
+        janus_Profiler.historyCount++;
+    }
+    janus_Profiler.frameCount++;
+}
+void janus_GetProfilerStats(uint8_t zone, struct janus_ProfilerStats* stats) {
+    uint32_t minimum = 0xFFFFFFFF, maximum = 0, total = 0, ticks;
+    uint8_t i;
+    if(janus_Profiler.historyCount == 0) {
+        stats->minimum = stats->average = stats->maximum = 0;
+        return;
+    }
+    for(i = 0; i < janus_Profiler.historyCount; i++) {
+        ticks = janus_Profiler.history[i][zone];
+        total += ticks;
+        if(ticks < minimum) {
+            minimum = ticks;
+        }
+        if(ticks > maximum) {
+            maximum = ticks;
+        }
+    }
+    /* Only divided when stats are asked for, never while timing */
+    stats->minimum = minimum / JANUS_TIMER_TICKS_PER_US;
+    stats->average = total / janus_Profiler.historyCount / JANUS_TIMER_TICKS_PER_US;
+    stats->maximum = maximum / JANUS_TIMER_TICKS_PER_US;
+}
+void janus_RenderProfiler(uint24_t x, uint8_t y, uint8_t backgroundColor, uint8_t foregroundColor) {
+    struct janus_ProfilerStats stats;
+    uint8_t zone, rows = 0;
+    uint8_t lineY = y + JANUS_QUICKUI_PADDING;
+    uint24_t width = 0;
+
+    for(zone = 0; zone < JANUS_PROFILER_MAX_ZONES; zone++) {
+        if(janus_Profiler.zones[zone].name != NULL) {
+            width = janus_Max(width,gfx_GetStringWidth(janus_Profiler.zones[zone].name));
+            rows++;
+        }
+    }
+    if(rows == 0) {
+        return;
+    }
+    gfx_SetTextScale(1,1);
+    gfx_SetColor(backgroundColor);
+    gfx_FillRectangle_NoClip(x,y,width + JANUS_PROFILER_NUMBER_WIDTH * 2 + JANUS_QUICKUI_PADDING * 4,rows * JANUS_QUICKUI_BUTTON_HEIGHT + JANUS_QUICKUI_PADDING * 2);
+    gfx_SetColor(foregroundColor);
+    gfx_Rectangle_NoClip(x,y,width + JANUS_PROFILER_NUMBER_WIDTH * 2 + JANUS_QUICKUI_PADDING * 4,rows * JANUS_QUICKUI_BUTTON_HEIGHT + JANUS_QUICKUI_PADDING * 2);
+    gfx_SetTextFGColor(foregroundColor);
+    for(zone = 0; zone < JANUS_PROFILER_MAX_ZONES; zone++) {
+        if(janus_Profiler.zones[zone].name == NULL) {
+            continue;
+        }
+        janus_GetProfilerStats(zone,&stats);
+        gfx_PrintStringXY(janus_Profiler.zones[zone].name,x + JANUS_QUICKUI_PADDING,lineY);
+        gfx_SetTextXY(x + width + JANUS_QUICKUI_PADDING * 2,lineY);
+        gfx_PrintUInt(stats.average,1);
+        gfx_SetTextXY(x + width + JANUS_PROFILER_NUMBER_WIDTH + JANUS_QUICKUI_PADDING * 3,lineY);
+        gfx_PrintUInt(stats.maximum,1);
+        lineY += JANUS_QUICKUI_BUTTON_HEIGHT;
+    }
+}
+
+#ifndef __TICE__
+void janus_DumpProfilerCSV(FILE* file) {
+    uint8_t zone, i, row;
+    fprintf(file,"frame");
+    for(zone = 0; zone < JANUS_PROFILER_MAX_ZONES; zone++) {
+        if(janus_Profiler.zones[zone].name != NULL) {
+            fprintf(file,",%s",janus_Profiler.zones[zone].name);
+        }
+    }
+    fprintf(file,"\n");
+    for(i = 0; i < janus_Profiler.historyCount; i++) {
+        /* Oldest frame first; once the ring is full, that's the one at the head */
+        row = janus_Profiler.historyCount < JANUS_PROFILER_HISTORY ? i : (janus_Profiler.historyHead + i) % JANUS_PROFILER_HISTORY;
+        fprintf(file,"%lu",(unsigned long)(janus_Profiler.frameCount - janus_Profiler.historyCount + i));
+        for(zone = 0; zone < JANUS_PROFILER_MAX_ZONES; zone++) {
+            if(janus_Profiler.zones[zone].name != NULL) {
+                fprintf(file,",%lu",(unsigned long)(janus_Profiler.history[row][zone] / JANUS_TIMER_TICKS_PER_US));
+            }
+        }
+        fprintf(file,"\n");
+    }
+}
+#endif
+#endif
+
+/* Recording being written or replayed by janus_GetDeltaTime(...), if any */
+static struct janus_InputRecording* janus_ActiveRecording;
+/* Keys as of the last janus_UpdateDebouncedKeys(...); recordings start from them */
+static uint8_t janus_LastPressed[KB_DATA_SIZE];
+/* clock() as of the last janus_GetDeltaTime(...) */
+static clock_t janus_PreviousTime;
+
+uint8_t janus_GetKeyGroup(uint8_t group) {
+    struct janus_InputRecording* recording = janus_ActiveRecording;
+    if(recording != NULL && recording->replaying) {
+        return recording->keys[group];
+    }
+    if(recording != NULL && recording->recording && recording->frameOpen) {
+        /* The keypad is taken once, when the frame first reads it, so what gets recorded is what the frame used */
+        if(!recording->keysTaken) {
+            uint8_t i;
+            for(i = 1; i < KB_DATA_SIZE; i++) {
+                recording->frameKeys[i] = kb_Data[i];
+            }
+            recording->keysTaken = true;
+        }
+        return recording->frameKeys[group];
+    }
+    return kb_Data[group];
+}
+
+void janus_UpdateDebouncedKeys(void) {
+    uint8_t i;
+    for(i = 1; i < KB_DATA_SIZE; i++) {
+        uint8_t keys = janus_GetKeyGroup(i);
+        janus_PressedOrReleasedKeys[i] = janus_LastPressed[i] ^ keys;
+        janus_ReleasedKeys[i] = janus_LastPressed[i] & janus_PressedOrReleasedKeys[i];
+        janus_PressedKeys[i] = (~janus_LastPressed[i]) & janus_PressedOrReleasedKeys[i];
+        
+        // There's probably an easy way to copy the data from kb_Data to this variable
+        // ...but I couldn't find it
+        janus_LastPressed[i] = keys;
+    }
+}
+
+void janus_InitInputQueue(struct janus_InputQueue* queue) {
+    uint8_t i;
+    queue->head = 0;
+    queue->eventCount = 0;
+    queue->dropped = 0;
+    for(i = 0; i < KB_DATA_SIZE; i++) {
+        queue->lastKeys[i] = 0;
+        queue->repeatDelays[i] = 0;
+        queue->repeatRates[i] = 0;
+        queue->repeatKeys[i] = 0;
+        queue->nextRepeats[i] = 0;
+    }
+}
+void janus_SetKeyRepeat(struct janus_InputQueue* queue, uint8_t group, uint24_t delayMS, uint24_t rateMS) {
+    queue->repeatDelays[group] = delayMS;
+    queue->repeatRates[group] = rateMS;
+}
+
+/* Adds an event to the back of the queue, or counts it as dropped if the queue is full */
+static void janus_PushInputEvent(struct janus_InputQueue* queue, uint8_t group, uint8_t key, uint8_t type, uint24_t nowMS) {
+    struct janus_InputEvent* event;
+    uint8_t tail;
+    if(queue->eventCount == JANUS_INPUT_MAX_EVENTS) {
+        queue->dropped++;
+        return;
+    }
+    tail = queue->head + queue->eventCount++;
+    if(tail >= JANUS_INPUT_MAX_EVENTS) {
+        tail -= JANUS_INPUT_MAX_EVENTS;
+    }
+    event = &queue->events[tail];
+    event->group = group;
+    event->key = key;
+    event->type = type;
+    event->time = nowMS;
+}
+
+void janus_PollInput(struct janus_InputQueue* queue, uint24_t nowMS) {
+    uint8_t group, key, keys, changed;
+    for(group = 1; group < KB_DATA_SIZE; group++) {
+        keys = janus_GetKeyGroup(group);
+        changed = keys ^ queue->lastKeys[group];
+        for(key = 1; changed != 0; key <<= 1) {
+            if(!(changed & key)) {
+                continue;
+            }
+            changed &= ~key;
+            if(keys & key) {
+                janus_PushInputEvent(queue,group,key,JANUS_INPUT_DOWN,nowMS);
+                queue->repeatKeys[group] = key;
+                queue->nextRepeats[group] = nowMS + queue->repeatDelays[group];
+            } else {
+                janus_PushInputEvent(queue,group,key,JANUS_INPUT_UP,nowMS);
+                if(queue->repeatKeys[group] == key) {
+                    queue->repeatKeys[group] = 0;
+                }
+            }
+        }
+        queue->lastKeys[group] = keys;
+
+        /* Compared as a difference so a wrapping clock still works */
+        if(queue->repeatRates[group] != 0 && queue->repeatKeys[group] != 0 && (int24_t)(nowMS - queue->nextRepeats[group]) >= 0) {
+            janus_PushInputEvent(queue,group,queue->repeatKeys[group],JANUS_INPUT_REPEAT,nowMS);
+            queue->nextRepeats[group] += queue->repeatRates[group];
+            /* After a long stall, repeat once and carry on from now instead of flooding the queue */
+            if((int24_t)(nowMS - queue->nextRepeats[group]) >= 0) {
+                queue->nextRepeats[group] = nowMS + queue->repeatRates[group];
+            }
+        }
+    }
+}
+bool janus_PopInputEvent(struct janus_InputQueue* queue, struct janus_InputEvent* event) {
+    if(queue->eventCount == 0) {
+        return false;
+    }
+    *event = queue->events[queue->head];
+    queue->eventCount--;
+    if(++queue->head == JANUS_INPUT_MAX_EVENTS) {
+        queue->head = 0;
+    }
+    return true;
+}
+
+/* Checks a recording has room for bytes more bytes plus one to close a final run, and stops it if not */
+static bool janus_ReserveRecording(struct janus_InputRecording* recording, uint24_t bytes) {
+    if(recording->size + bytes + 1 > recording->capacity) {
+        recording->recording = false;
+        recording->overflowed = true;
+        return false;
+    }
+    return true;
+}
+
+/* Writes out frames that matched the one before them as a single run */
+static void janus_FlushRecordingRun(struct janus_InputRecording* recording) {
+    if(recording->repeats > 0) {
+        recording->data[recording->size++] = JANUS_RECORDING_RUN | (recording->repeats - 1);
+        recording->repeats = 0;
+    }
+}
+
+/* Adds the open frame to a recording, only storing what changed since the last frame */
+static void janus_RecordFrame(struct janus_InputRecording* recording) {
+    uint8_t header = 0, changedGroups = 0, group;
+    uint24_t bytes = 1;
+    int24_t deltaTime = recording->frameDelta;
+    recording->frameOpen = false;
+    for(group = 1; group < KB_DATA_SIZE; group++) {
+        if(recording->frameKeys[group] != recording->keys[group]) {
+            changedGroups |= 1 << group;
+            bytes++;
+        }
+    }
+    if(changedGroups != 0) {
+        header |= JANUS_RECORDING_KEYS;
+        bytes++;
+    }
+    if(deltaTime != recording->deltaTime || recording->frameCount == 0) {
+        header |= JANUS_RECORDING_DELTA;
+        bytes += 2;
+    }
+    if(header == 0) {
+        recording->frameCount++;
+        if(++recording->repeats == 0x80 && janus_ReserveRecording(recording,1)) {
+            janus_FlushRecordingRun(recording);
+        }
+        return;
+    }
+    if(!janus_ReserveRecording(recording,bytes + (recording->repeats > 0 ? 1 : 0))) {
+        return;
+    }
+    recording->frameCount++;
+    janus_FlushRecordingRun(recording);
+    recording->data[recording->size++] = header;
+    if(changedGroups != 0) {
+        recording->data[recording->size++] = changedGroups;
+        for(group = 1; group < KB_DATA_SIZE; group++) {
+            if(changedGroups & (1 << group)) {
+                recording->keys[group] = recording->frameKeys[group];
+                recording->data[recording->size++] = recording->keys[group];
+            }
+        }
+    }
+    if(header & JANUS_RECORDING_DELTA) {
+        recording->deltaTime = deltaTime;
+        recording->data[recording->size++] = deltaTime & 0xFF;
+        recording->data[recording->size++] = deltaTime >> 8;
+    }
+}
+
+/* Reads the next frame of a replay into recording->keys and recording->deltaTime; stops the replay at the end of the data */
+static void janus_ReplayFrame(struct janus_InputRecording* recording) {
+    uint8_t header, changedGroups, group;
+    if(recording->repeats > 0) {
+        recording->repeats--;
+        recording->frameCount++;
+        return;
+    }
+    if(recording->position >= recording->size) {
+        recording->replaying = false;
+        return;
+    }
+    header = recording->data[recording->position++];
+    recording->frameCount++;
+    if(header & JANUS_RECORDING_RUN) {
+        recording->repeats = header & 0x7F;
+        return;
+    }
+    if(header & JANUS_RECORDING_KEYS) {
+        changedGroups = recording->data[recording->position++];
+        for(group = 1; group < KB_DATA_SIZE; group++) {
+            if(changedGroups & (1 << group)) {
+                recording->keys[group] = recording->data[recording->position++];
+            }
+        }
+    }
+    if(header & JANUS_RECORDING_DELTA) {
+        recording->deltaTime = recording->data[recording->position] | (recording->data[recording->position + 1] << 8);
+        recording->position += 2;
+    }
+}
+
+void janus_StartRecording(struct janus_InputRecording* recording, uint8_t* buffer, uint24_t capacity) {
+    uint8_t group;
+    memset(recording,0,sizeof(struct janus_InputRecording));
+    recording->data = buffer;
+    recording->capacity = capacity;
+    recording->recording = true;
+    janus_ActiveRecording = recording;
+    if(!janus_ReserveRecording(recording,JANUS_RECORDING_START_BYTES)) {
+        return;
+    }
+    /* Frames only store what changed, so start from the debounced keys a replay has to restore */
+    for(group = 1; group < KB_DATA_SIZE; group++) {
+        recording->keys[group] = recording->frameKeys[group] = janus_LastPressed[group];
+        recording->data[recording->size++] = janus_LastPressed[group];
+    }
+}
+uint24_t janus_StopRecording(struct janus_InputRecording* recording) {
+    if(recording->recording && recording->frameOpen) {
+        janus_RecordFrame(recording);
+    }
+    /* Recording always leaves a byte spare for this */
+    janus_FlushRecordingRun(recording);
+    recording->recording = false;
+    if(janus_ActiveRecording == recording) {
+        janus_ActiveRecording = NULL;
+    }
+    return recording->size;
+}
+void janus_StartReplay(struct janus_InputRecording* recording, const uint8_t* data, uint24_t size) {
+    uint8_t group;
+    memset(recording,0,sizeof(struct janus_InputRecording));
+    /* Never written to while replaying */
+    recording->data = (uint8_t*)data;
+    recording->size = size;
+    janus_ActiveRecording = recording;
+    if(size < JANUS_RECORDING_START_BYTES) {
+        return;
+    }
+    recording->replaying = true;
+    for(group = 1; group < KB_DATA_SIZE; group++) {
+        recording->keys[group] = janus_LastPressed[group] = data[recording->position++];
+    }
+}
+void janus_StopReplay(struct janus_InputRecording* recording) {
+    if(recording->replaying) {
+        /* Time spent replaying doesn't count towards the next real frame */
+        janus_PreviousTime = clock();
+    }
+    recording->replaying = false;
+    if(janus_ActiveRecording == recording) {
+        janus_ActiveRecording = NULL;
+    }
+}
+
+uint24_t janus_HashBytes(uint24_t hash, const void* data, uint24_t size) {
+    const uint8_t* bytes = data;
+    while(size-- > 0) {
+        /* 403 is the 32-bit FNV prime with its top byte dropped */
+        hash = ((hash ^ *bytes++) * 403) & 0xFFFFFF;
+    }
+    return hash;
+}
+
+int24_t janus_GetDeltaTime(void) {
+    clock_t currentTime;
+    int24_t output = 0;
+
+    if(janus_ActiveRecording != NULL && janus_ActiveRecording->replaying) {
+        janus_ReplayFrame(janus_ActiveRecording);
+        if(janus_ActiveRecording->replaying) {
+            return janus_ActiveRecording->deltaTime;
+        }
+        /* The replay just ran out; time spent replaying doesn't count towards this frame */
+        janus_PreviousTime = clock();
+    }
+
+    currentTime = clock();
+    output = (currentTime - janus_PreviousTime) * 1000 / CLOCKS_PER_SEC;
+    janus_PreviousTime = currentTime;
+
+    if(janus_ActiveRecording != NULL && janus_ActiveRecording->recording) {
+        /* The last frame has read all the keys it's going to, so it can be written out */
+        if(janus_ActiveRecording->frameOpen) {
+            janus_RecordFrame(janus_ActiveRecording);
+        }
+        /* Replays only carry 16 bits of delta time, so hand back exactly what will be recorded */
+        if(output < 0) {
+            output = 0;
+        } else if(output > 0xFFFF) {
+            output = 0xFFFF;
+        }
+        if(janus_ActiveRecording->recording) {
+            janus_ActiveRecording->frameDelta = output;
+            janus_ActiveRecording->frameOpen = true;
+            janus_ActiveRecording->keysTaken = false;
+        }
+    }
+    return output;
+}
+
+int24_t janus_GetFPS(int24_t msElapsed) {
+    if(msElapsed <= 0) {
+        /* Too fast for the clock to measure */
+        return 1000;
+    }
+    return 1000 / msElapsed;
+}
+
+void janus_InitFrameClock(struct janus_FrameClock* clock, uint8_t targetFPS) {
+    memset(clock,0,sizeof(struct janus_FrameClock));
+    janus_StartTimer();
+    janus_SetFrameLimit(clock,targetFPS);
+    /* janus_SetFrameLimit(...) already set the deadline, so the first frame is held to the limit too */
+    clock->lastTicks = janus_GetTimerTicks();
+}
+void janus_SetFrameLimit(struct janus_FrameClock* clock, uint8_t targetFPS) {
+    clock->ticksPerFrame = targetFPS == 0 ? 0 : (uint32_t)JANUS_TIMER_TICKS_PER_US * 1000000 / targetFPS;
+    clock->deadline = janus_GetTimerTicks() + clock->ticksPerFrame;
+}
+uint24_t janus_TickFrameClock(struct janus_FrameClock* clock) {
+    uint32_t now = janus_GetTimerTicks();
+    uint32_t remaining;
+
+    if(clock->ticksPerFrame != 0) {
+        /* Signed difference so a wrapped counter still compares the right way */
+        if((int32_t)(clock->deadline - now) > 0) {
+            remaining = clock->deadline - now;
+#ifdef __TICE__
+            /* Sleep off whole milliseconds, then spin for the rest */
+            if(remaining >= JANUS_TIMER_TICKS_PER_US * 1000) {
+                delay(remaining / (JANUS_TIMER_TICKS_PER_US * 1000));
+            }
+#else
+            {
+                struct timespec wait = {remaining / 1000000, (remaining % 1000000) * 1000};
+                nanosleep(&wait,NULL);
+            }
+#endif
+            do {
+                now = janus_GetTimerTicks();
+            } while((int32_t)(clock->deadline - now) > 0);
+            clock->deadline += clock->ticksPerFrame;
+        } else {
+            /* Already late; start counting again from now rather than rushing the next frames to catch up */
+            clock->deadline = now + clock->ticksPerFrame;
+        }
+    }
+
+    clock->deltaUS = (now - clock->lastTicks) / JANUS_TIMER_TICKS_PER_US;
+    clock->lastTicks = now;
+
+    clock->partialUS += clock->deltaUS;
+    clock->deltaMS = clock->partialUS / 1000;
+    clock->partialUS -= clock->deltaMS * 1000;
+
+    clock->frameTimes[clock->head] = clock->deltaUS;
+    if(++clock->head == JANUS_FRAME_CLOCK_WINDOW) {
+        clock->head = 0;
+    }
+    if(clock->count < JANUS_FRAME_CLOCK_WINDOW) {
+        clock->count++;
+    }
+    return clock->deltaUS;
+}
+void janus_GetFrameStats(const struct janus_FrameClock* clock, struct janus_FrameStats* stats) {
+    uint24_t sorted[JANUS_FRAME_CLOCK_WINDOW];
+    uint32_t total = 0;
+    uint24_t value;
+    uint8_t i, j;
+
+    if(clock->count == 0) {
+        memset(stats,0,sizeof(struct janus_FrameStats));
+        return;
+    }
+    /* Insertion sort; the window is small */
+    for(i = 0; i < clock->count; i++) {
+        value = clock->frameTimes[i];
+        total += value;
+        for(j = i; j > 0 && sorted[j - 1] > value; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = value;
+    }
+    stats->average = total / clock->count;
+    /* Nearest rank: the smallest frame time at least 95% (or 99%) of frames are no slower than */
+    stats->p95 = sorted[((uint24_t)clock->count * 95 + 99) / 100 - 1];
+    stats->p99 = sorted[((uint24_t)clock->count * 99 + 99) / 100 - 1];
+    stats->worst = sorted[clock->count - 1];
+    stats->fps = total == 0 ? 0 : (uint32_t)clock->count * 1000000 / total;
+}
+
+
+
+//https://easings.net/ for reference
+#define JANUS_EASE_TABLE_SIZE 65 // Entries per easing table; alpha 0-1000 is split into 64 segments
+
+/* Each table is round(1000 * in(i / 64)) for a family's ease-in curve; the out and in-out modes are mirrored from it. Generated by tests/gen_tables.c */
+static const int16_t janus_EaseQuadTable[JANUS_EASE_TABLE_SIZE] = {
+    0, 0, 1, 2, 4, 6, 9, 12, 16, 20, 24, 30, 35, 41, 48, 55,
+    62, 71, 79, 88, 98, 108, 118, 129, 141, 153, 165, 178, 191, 205, 220, 235,
+    250, 266, 282, 299, 316, 334, 353, 371, 391, 410, 431, 451, 473, 494, 517, 539,
+    562, 586, 610, 635, 660, 686, 712, 739, 766, 793, 821, 850, 879, 908, 938, 969,
+    1000
+};
+#if JANUS_EASE_CUBIC
+static const int16_t janus_EaseCubicTable[JANUS_EASE_TABLE_SIZE] = {
+    0, 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 5, 7, 8, 10, 13,
+    16, 19, 22, 26, 31, 35, 41, 46, 53, 60, 67, 75, 84, 93, 103, 114,
+    125, 137, 150, 164, 178, 193, 209, 226, 244, 263, 283, 303, 325, 348, 371, 396,
+    422, 449, 477, 506, 536, 568, 601, 635, 670, 706, 744, 783, 824, 866, 909, 954,
+    1000
+};
+#endif
+#if JANUS_EASE_SINE
+static const int16_t janus_EaseSineTable[JANUS_EASE_TABLE_SIZE] = {
+    0, 0, 1, 3, 5, 8, 11, 15, 19, 24, 30, 36, 43, 50, 58, 67,
+    76, 86, 96, 107, 118, 130, 142, 155, 169, 182, 197, 212, 227, 243, 259, 276,
+    293, 310, 328, 347, 366, 385, 404, 424, 444, 465, 486, 507, 529, 550, 572, 595,
+    617, 640, 663, 686, 710, 733, 757, 781, 805, 829, 853, 878, 902, 926, 951, 975,
+    1000
+};
+#endif
+#if JANUS_EASE_BACK
+static const int16_t janus_EaseBackTable[JANUS_EASE_TABLE_SIZE] = {
+    0, 0, -2, -3, -6, -9, -13, -17, -21, -26, -31, -37, -42, -48, -53, -59,
+    -64, -69, -74, -79, -84, -88, -91, -94, -97, -99, -100, -100, -99, -98, -96, -92,
+    -88, -82, -75, -67, -58, -47, -34, -21, -5, 12, 31, 51, 74, 98, 124, 152,
+    183, 215, 250, 287, 326, 367, 411, 458, 507, 559, 613, 670, 731, 793, 859, 928,
+    1000
+};
+#endif
+#if JANUS_EASE_ELASTIC
+static const int16_t janus_EaseElasticTable[JANUS_EASE_TABLE_SIZE] = {
+    0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 1, 0, -1, -2, -4, -5,
+    -6, -6, -5, -4, -2, 1, 4, 8, 11, 14, 16, 16, 14, 10, 3, -5,
+    -16, -26, -36, -43, -47, -45, -36, -21, 0, 27, 56, 86, 111, 127, 132, 119,
+    88, 38, -29, -108, -193, -272, -336, -370, -364, -309, -200, -38, 168, 401, 639, 850,
+    1000
+};
+#endif
+#if JANUS_EASE_BOUNCE
+static const int16_t janus_EaseBounceTable[JANUS_EASE_TABLE_SIZE] = {
+    0, 9, 14, 16, 13, 8, 4, 23, 38, 50, 58, 62, 62, 59, 52, 42,
+    27, 9, 23, 62, 97, 129, 157, 182, 202, 219, 232, 242, 248, 250, 248, 243,
+    234, 222, 206, 186, 162, 135, 103, 69, 30, 23, 106, 186, 261, 333, 402, 466,
+    527, 585, 638, 688, 734, 777, 815, 850, 882, 910, 934, 954, 970, 983, 993, 998,
+    1000
+};
+#endif
+
+/* Returns the ease-in table for an easing mode, or NULL for LINEAR and families left out of the build */
+static const int16_t* janus_GetEaseTable(enum janus_EasingMode easingMode) {
+    switch(easingMode) {
+        case QUAD_IN:
+        case QUAD_OUT:
+        case QUAD_IN_OUT:
+            return janus_EaseQuadTable;
+#if JANUS_EASE_CUBIC
+        case CUBIC_IN:
+        case CUBIC_OUT:
+        case CUBIC_IN_OUT:
+            return janus_EaseCubicTable;
+#endif
+#if JANUS_EASE_SINE
+        case SINE_IN:
+        case SINE_OUT:
+        case SINE_IN_OUT:
+            return janus_EaseSineTable;
+#endif
+#if JANUS_EASE_BACK
+        case BACK_IN:
+        case BACK_OUT:
+        case BACK_IN_OUT:
+            return janus_EaseBackTable;
+#endif
+#if JANUS_EASE_ELASTIC
+        case ELASTIC_IN:
+        case ELASTIC_OUT:
+        case ELASTIC_IN_OUT:
+            return janus_EaseElasticTable;
+#endif
+#if JANUS_EASE_BOUNCE
+        case BOUNCE_IN:
+        case BOUNCE_OUT:
+        case BOUNCE_IN_OUT:
+            return janus_EaseBounceTable;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+/* Linearly interpolates between the two table entries around alpha (0-1000) */
+static int24_t janus_SampleEaseTable(const int16_t* table, uint24_t alpha) {
+    /* alpha * 8389 >> 9 is alpha * 64 / 1000 in 8.8 fixed point, without the divide */
+    uint24_t position = alpha * 8389 >> 9;
+    uint8_t index = position >> 8;
+    if(index >= JANUS_EASE_TABLE_SIZE - 1) {
+        return table[JANUS_EASE_TABLE_SIZE - 1];
+    }
+    return table[index] + (((int24_t)(table[index + 1] - table[index]) * (int24_t)(position & 0xFF)) >> 8);
+}
+
+int24_t janus_GetEaseProgress(enum janus_EasingMode easingMode, uint24_t alpha) {
+    const int16_t* table = janus_GetEaseTable(easingMode);
+    if(alpha > JANUS_ONE_SECOND) {
+        alpha = JANUS_ONE_SECOND;
+    }
+    if(table == NULL) {
+        return alpha;
+    }
+    switch(easingMode) {
+        case QUAD_IN:
+        case CUBIC_IN:
+        case SINE_IN:
+        case BACK_IN:
+        case ELASTIC_IN:
+        case BOUNCE_IN:
+            return janus_SampleEaseTable(table,alpha);
+        case QUAD_OUT:
+        case CUBIC_OUT:
+        case SINE_OUT:
+        case BACK_OUT:
+        case ELASTIC_OUT:
+        case BOUNCE_OUT:
+            return JANUS_ONE_SECOND - janus_SampleEaseTable(table,JANUS_ONE_SECOND - alpha);
+        default:
+            return alpha <= JANUS_ONE_SECOND/2 ? janus_SampleEaseTable(table,alpha * 2) / 2 : JANUS_ONE_SECOND - janus_SampleEaseTable(table,JANUS_ONE_SECOND * 2 - alpha * 2) / 2;
+    }
+}
+void janus_UpdateEase(struct janus_Ease* ease, int24_t msElapsed) {
+    int24_t alpha;
+
+    if(msElapsed == 0) {
+        return;
+    }
+    
+    ease->progress = ease->progress + (ease->reverse ? -msElapsed : msElapsed);
+    if(ease->progress > ease->length) {
+        ease->progress = ease->length;
+    }
+    if(ease->progress < 0) {
+        ease->progress = 0;
+    }
+    alpha = janus_GetEaseProgress(ease->easingMode,ease->progress*1000/ease->length);
+    if(ease->fromX != ease->toX) {
+        ease->currentX = janus_LerpInt24ByInt(ease->fromX,ease->toX,alpha);
+    } else {
+        ease->currentX = ease->toX;
+    }
+    if(ease->fromY != ease->toY) {
+        ease->currentY = janus_LerpInt24ByInt(ease->fromY,ease->toY,alpha);
+    } else {
+        ease->currentY = ease->toY;
+    }
+}
+
+/* Turns progress through an ease into alpha (0-1000) using a cached (1000 << JANUS_TWEEN_ALPHA_SHIFT) / length */
+static int24_t janus_GetCachedAlpha(int24_t progress, int24_t length, int24_t alphaPerMS) {
+    if(progress <= 0) {
+        return 0;
+    }
+    if(progress >= length) {
+        return JANUS_ONE_SECOND;
+    }
+    return (progress * alphaPerMS) >> JANUS_TWEEN_ALPHA_SHIFT;
+}
+
+void janus_InitTimedEase(struct janus_TimedEase* ease, struct janus_Vector2* from, struct janus_Vector2* to, uint24_t startTime, int24_t length, enum janus_EasingMode easingMode) {
+    if(length < 1) {
+        length = 1;
+    }
+    ease->easingMode = easingMode;
+    ease->from = *from;
+    ease->to = *to;
+    ease->startTime = startTime;
+    ease->length = length;
+    ease->alphaPerMS = (JANUS_ONE_SECOND << JANUS_TWEEN_ALPHA_SHIFT) / length;
+}
+struct janus_Vector2 janus_EaseSampleAt(struct janus_TimedEase* ease, uint24_t nowMS) {
+    /* Subtracting first means a clock that wraps past startTime still gives the right difference */
+    int24_t alpha = janus_GetEaseProgress(ease->easingMode,janus_GetCachedAlpha((int24_t)(nowMS - ease->startTime),ease->length,ease->alphaPerMS));
+    return (struct janus_Vector2){
+        ease->from.x + JANUS_APPLY_DELTA_TIME(ease->to.x - ease->from.x,alpha),
+        ease->from.y + JANUS_APPLY_DELTA_TIME(ease->to.y - ease->from.y,alpha)
+    };
+}
+bool janus_IsEaseFinishedAt(struct janus_TimedEase* ease, uint24_t nowMS) {
+    return (int24_t)(nowMS - ease->startTime) >= ease->length;
+}
+
+void janus_InitTweens(struct janus_TweenPool* pool) {
+    uint8_t i;
+    pool->tweenCount = 0;
+    pool->freeCount = JANUS_TWEEN_MAX_TWEENS;
+    for(i = 0; i < JANUS_TWEEN_MAX_TWEENS; i++) {
+        pool->indices[i] = JANUS_TWEEN_NONE;
+        pool->freeHandles[i] = JANUS_TWEEN_MAX_TWEENS - 1 - i;
+    }
+}
+
+/* Takes a free handle and appends its tween to the packed array; returns NULL if the pool is full */
+static struct janus_Tween* janus_AllocateTween(struct janus_TweenPool* pool, int24_t* target, int24_t from, int24_t to, int24_t length, enum janus_EasingMode easingMode) {
+    struct janus_Tween* tween;
+    uint8_t handle;
+    if(pool->freeCount == 0) {
+        return NULL;
+    }
+    if(length < 1) {
+        length = 1;
+    }
+    handle = pool->freeHandles[--pool->freeCount];
+    pool->indices[handle] = pool->tweenCount;
+    tween = &pool->tweens[pool->tweenCount++];
+    *tween = (struct janus_Tween){
+        .target = target,
+        .from = from,
+        .change = to - from,
+        .length = length,
+        .alphaPerMS = (JANUS_ONE_SECOND << JANUS_TWEEN_ALPHA_SHIFT) / length,
+        .easingMode = easingMode,
+        .handle = handle,
+        .next = JANUS_TWEEN_NONE
+    };
+    return tween;
+}
+
+/* Swaps the last tween into index so the array stays packed, and frees the removed tween's handle */
+static void janus_RemoveTween(struct janus_TweenPool* pool, uint8_t index) {
+    uint8_t last = --pool->tweenCount;
+    pool->indices[pool->tweens[index].handle] = JANUS_TWEEN_NONE;
+    pool->freeHandles[pool->freeCount++] = pool->tweens[index].handle;
+    if(index != last) {
+        pool->tweens[index] = pool->tweens[last];
+        pool->indices[pool->tweens[index].handle] = index;
+    }
+}
+
+/* Writes a tween's current value to its target */
+static void janus_ApplyTween(struct janus_Tween* tween) {
+    int24_t alpha = janus_GetCachedAlpha(tween->progress,tween->length,tween->alphaPerMS);
+    *tween->target = tween->from + JANUS_APPLY_DELTA_TIME(tween->change,janus_GetEaseProgress(tween->easingMode,alpha));
+}
+
+uint8_t janus_StartTween(struct janus_TweenPool* pool, int24_t* target, int24_t from, int24_t to, int24_t length, enum janus_EasingMode easingMode) {
+    struct janus_Tween* tween = janus_AllocateTween(pool,target,from,to,length,easingMode);
+    if(tween == NULL) {
+        return JANUS_TWEEN_NONE;
+    }
+    janus_ApplyTween(tween);
+    return tween->handle;
+}
+uint8_t janus_ChainTween(struct janus_TweenPool* pool, uint8_t after, int24_t* target, int24_t from, int24_t to, int24_t length, enum janus_EasingMode easingMode) {
+    struct janus_Tween* tween;
+    if(!janus_IsTweenLive(pool,after)) {
+        return JANUS_TWEEN_NONE;
+    }
+    tween = janus_AllocateTween(pool,target,from,to,length,easingMode);
+    if(tween == NULL) {
+        return JANUS_TWEEN_NONE;
+    }
+    tween->waiting = true;
+    /* Follow the chain to its end; allocating never moves existing tweens, so looking them up again is safe */
+    while(pool->tweens[pool->indices[after]].next != JANUS_TWEEN_NONE) {
+        after = pool->tweens[pool->indices[after]].next;
+    }
+    pool->tweens[pool->indices[after]].next = tween->handle;
+    return tween->handle;
+}
+void janus_YoyoTween(struct janus_TweenPool* pool, uint8_t handle) {
+    if(janus_IsTweenLive(pool,handle)) {
+        pool->tweens[pool->indices[handle]].yoyo = true;
+    }
+}
+void janus_CancelTween(struct janus_TweenPool* pool, uint8_t handle) {
+    uint8_t i, next;
+    if(!janus_IsTweenLive(pool,handle)) {
+        return;
+    }
+    /* Unlink it from whatever it was chained after */
+    for(i = 0; i < pool->tweenCount; i++) {
+        if(pool->tweens[i].next == handle) {
+            pool->tweens[i].next = JANUS_TWEEN_NONE;
+        }
+    }
+    while(handle != JANUS_TWEEN_NONE) {
+        next = pool->tweens[pool->indices[handle]].next;
+        janus_RemoveTween(pool,pool->indices[handle]);
+        handle = next;
+    }
+}
+bool janus_IsTweenLive(struct janus_TweenPool* pool, uint8_t handle) {
+    return handle < JANUS_TWEEN_MAX_TWEENS && pool->indices[handle] != JANUS_TWEEN_NONE;
+}
+void janus_UpdateTweens(struct janus_TweenPool* pool, int24_t msElapsed) {
+    uint8_t started[JANUS_TWEEN_MAX_TWEENS];
+    uint8_t startedCount = 0;
+    uint8_t i = 0;
+    struct janus_Tween* tween;
+
+    while(i < pool->tweenCount) {
+        tween = &pool->tweens[i];
+        if(tween->waiting) {
+            i++;
+            continue;
+        }
+        tween->progress += tween->reverse ? -msElapsed : msElapsed;
+        if(tween->yoyo) {
+            /* Bounce off either end, keeping any time left over */
+            if(tween->progress >= tween->length) {
+                tween->progress = 2 * tween->length - tween->progress;
+                tween->reverse = true;
+            } else if(tween->progress <= 0) {
+                tween->progress = -tween->progress;
+                tween->reverse = false;
+            }
+            if(tween->progress < 0) {
+                tween->progress = 0;
+            } else if(tween->progress > tween->length) {
+                tween->progress = tween->length;
+            }
+        } else if(tween->progress >= tween->length) {
+            *tween->target = tween->from + tween->change;
+            if(tween->next != JANUS_TWEEN_NONE) {
+                /* The chained tween starts with the time this one overshot by, once this pass is over so it isn't advanced twice */
+                pool->tweens[pool->indices[tween->next]].progress = tween->progress - tween->length;
+                started[startedCount++] = tween->next;
+            }
+            janus_RemoveTween(pool,i);
+            continue;
+        }
+        janus_ApplyTween(tween);
+        i++;
+    }
+    for(i = 0; i < startedCount; i++) {
+        tween = &pool->tweens[pool->indices[started[i]]];
+        tween->waiting = false;
+        janus_ApplyTween(tween);
+    }
+}
+
+/* Moves currentFrame on from where it was last time instead of searching from the start; timings is NULL for constant timing */
+static void janus_AdvanceAnimation(const uint24_t* timings, uint24_t constantTiming, uint24_t frameCount, bool loop, uint24_t* msElapsed, uint24_t* currentFrame, uint24_t* frameStart, uint24_t* length) {
+    uint24_t i;
+    if(*length == 0) {
+        if(timings != NULL) {
+            for(i = 0; i < frameCount; i++) {
+                *length += timings[i];
+            }
+        } else {
+            *length = frameCount * constantTiming;
+        }
+        if(*length == 0) {
+            *currentFrame = 0;
+            return;
+        }
+    }
+    if(*msElapsed >= *length) {
+        if(!loop) {
+            *msElapsed = *length;
+            *currentFrame = frameCount-1;
+            *frameStart = *length - (timings != NULL ? timings[frameCount-1] : constantTiming);
+            return;
+        }
+        /* One modulo covers however many loops a long frame skipped */
+        *msElapsed %= *length;
+    }
+    if(*msElapsed < *frameStart || *currentFrame >= frameCount) {
+        *currentFrame = 0;
+        *frameStart = 0;
+    }
+    /* Usually runs zero or one times */
+    while(*msElapsed >= *frameStart + (timings != NULL ? timings[*currentFrame] : constantTiming)) {
+        *frameStart += timings != NULL ? timings[*currentFrame] : constantTiming;
+        (*currentFrame)++;
+    }
+}
+
+void janus_UpdateAnimation(struct janus_Animation* animation, int24_t msElapsed) {
+    animation->msElapsed += msElapsed;
+    janus_AdvanceAnimation(animation->useVariableTimings ? animation->frameTimings.variableTimings : NULL,animation->frameTimings.constantTiming,animation->frameCount,animation->loop,&animation->msElapsed,&animation->currentFrame,&animation->frameStart,&animation->length);
+}
+gfx_sprite_t* janus_GetAnimationFrame(struct janus_Animation* animation) {
+    return animation->frames[animation->currentFrame];
+}
+
+void janus_InitAnimationPlayer(struct janus_AnimationPlayer* player, const struct janus_AnimationClip* clip) {
+    player->clip = clip;
+    player->msElapsed = 0;
+    player->currentFrame = 0;
+    player->speed = JANUS_FIXED_ONE;
+    player->partialMS = 0;
+    player->frameStart = 0;
+    player->length = 0;
+}
+void janus_UpdateAnimationPlayer(struct janus_AnimationPlayer* player, int24_t msElapsed) {
+    const struct janus_AnimationClip* clip = player->clip;
+    uint24_t scaledMS = msElapsed * player->speed + player->partialMS;
+    player->partialMS = scaledMS & (JANUS_FIXED_ONE - 1);
+    player->msElapsed += scaledMS >> JANUS_FIXED_SHIFT;
+    janus_AdvanceAnimation(clip->frameTimings,clip->constantTiming,clip->frameCount,clip->loop,&player->msElapsed,&player->currentFrame,&player->frameStart,&player->length);
+}
+gfx_sprite_t* janus_GetAnimationPlayerFrame(struct janus_AnimationPlayer* player) {
+    if(player->clip->frames == NULL) {
+        return janus_GetCachedFrame(player->clip->cache,player->clip->compressedFrames[player->currentFrame]);
+    }
+    return player->clip->frames[player->currentFrame];
+}
+
+/* Runs shorter than this are cheaper to store as literals */
+#define JANUS_RLE_MIN_RUN 3
+#define JANUS_RLE_MAX_LENGTH 128
+
+uint24_t janus_CompressSprite(const gfx_sprite_t* sprite, uint8_t* output, uint24_t maxSize) {
+    const uint8_t* data = sprite->data;
+    uint24_t pixelCount = sprite->width * sprite->height;
+    uint24_t written = 2;
+    uint24_t i = 0, run, literal;
+
+    /* Anything bigger couldn't be decompressed into a janus_FrameCache slot */
+    if(maxSize < 2 || pixelCount > JANUS_FRAME_CACHE_MAX_PIXELS) {
+        return 0;
+    }
+    output[0] = sprite->width;
+    output[1] = sprite->height;
+    while(i < pixelCount) {
+        run = 1;
+        while(i + run < pixelCount && run < JANUS_RLE_MAX_LENGTH && data[i + run] == data[i]) {
+            run++;
+        }
+        if(run >= JANUS_RLE_MIN_RUN) {
+            if(written + 2 > maxSize) {
+                return 0;
+            }
+            output[written++] = 0x80 | (run - 1);
+            output[written++] = data[i];
+            i += run;
+            continue;
+        }
+        /* Gather literals until the next worthwhile run starts */
+        literal = 0;
+        while(i + literal < pixelCount && literal < JANUS_RLE_MAX_LENGTH) {
+            if(i + literal + JANUS_RLE_MIN_RUN <= pixelCount && data[i + literal] == data[i + literal + 1] && data[i + literal] == data[i + literal + 2]) {
+                break;
+            }
+            literal++;
+        }
+        if(written + 1 + literal > maxSize) {
+            return 0;
+        }
+        output[written++] = literal - 1;
+        memcpy(&output[written],&data[i],literal);
+        written += literal;
+        i += literal;
+    }
+    return written;
+}
+gfx_sprite_t* janus_DecompressSprite(const uint8_t* compressed, gfx_sprite_t* sprite) {
+    uint24_t pixelCount = compressed[0] * compressed[1];
+    uint24_t written = 0, count;
+    uint8_t control;
+    sprite->width = compressed[0];
+    sprite->height = compressed[1];
+    compressed += 2;
+    while(written < pixelCount) {
+        control = *compressed++;
+        count = (control & 0x7F) + 1;
+        if(count > pixelCount - written) {
+            count = pixelCount - written;
+        }
+        if(control & 0x80) {
+            memset(&sprite->data[written],*compressed++,count);
+        } else {
+            memcpy(&sprite->data[written],compressed,count);
+            compressed += (control & 0x7F) + 1;
+        }
+        written += count;
+    }
+    return sprite;
+}
+
+void janus_InitTransformCache(struct janus_TransformCache* cache) {
+    cache->spriteCount = 0;
+    cache->bytesUsed = 0;
+    cache->uses = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+}
+
+/* Number of scaling and transform steps it takes to make a transformed sprite */
+static uint8_t janus_CountTransformSteps(uint8_t transform, uint8_t scale) {
+    uint8_t steps = scale != 1 ? 1 : 0;
+    uint8_t flag;
+    for(flag = JANUS_TRANSFORM_MIRROR; flag <= JANUS_TRANSFORM_ROTATE_HALF; flag <<= 1) {
+        if(transform & flag) {
+            steps++;
+        }
+    }
+    return steps;
+}
+
+/* Checks a width x height sprite can ever be transformed into the cache: it has to fit, along with a scratch copy if it takes more than one step */
+static bool janus_CanTransformSprite(uint8_t width, uint8_t height, uint8_t transform, uint8_t scale) {
+    uint24_t size = 2 + (uint24_t)width * scale * height * scale;
+    if(scale == 0 || (uint24_t)width * scale > 255 || (uint24_t)height * scale > 255) {
+        return false;
+    }
+    return (janus_CountTransformSteps(transform,scale) > 1 ? size * 2 : size) <= JANUS_TRANSFORM_CACHE_BYTES;
+}
+
+/* Returns the cached sprite for source, transform and scale, or NULL */
+static gfx_sprite_t* janus_FindTransformedSprite(struct janus_TransformCache* cache, const void* source, uint8_t transform, uint8_t scale) {
+    uint8_t i;
+    cache->uses++;
+    for(i = 0; i < cache->spriteCount; i++) {
+        struct janus_TransformedSprite* entry = &cache->sprites[i];
+        if(entry->source == source && entry->transform == transform && entry->scale == scale) {
+            cache->hits++;
+            entry->lastUsed = cache->uses;
+            return (gfx_sprite_t*)&cache->memory[entry->offset];
+        }
+    }
+    return NULL;
+}
+
+/* Throws out the least recently used sprite and slides the ones after it down so free memory stays in one piece */
+static void janus_EvictTransformedSprite(struct janus_TransformCache* cache) {
+    uint8_t i, oldest = 0;
+    uint24_t size;
+    for(i = 1; i < cache->spriteCount; i++) {
+        if(cache->sprites[i].lastUsed < cache->sprites[oldest].lastUsed) {
+            oldest = i;
+        }
+    }
+    size = cache->sprites[oldest].size;
+    memmove(&cache->memory[cache->sprites[oldest].offset],&cache->memory[cache->sprites[oldest].offset + size],cache->bytesUsed - cache->sprites[oldest].offset - size);
+    cache->bytesUsed -= size;
+    for(i = oldest; i + 1 < cache->spriteCount; i++) {
+        cache->sprites[i] = cache->sprites[i + 1];
+        cache->sprites[i].offset -= size;
+    }
+    cache->spriteCount--;
+    cache->evictions++;
+}
+
+/* Makes and stores a transformed copy of sprite under source; janus_CanTransformSprite(...) has to have said it fits */
+static gfx_sprite_t* janus_AddTransformedSprite(struct janus_TransformCache* cache, const void* source, const gfx_sprite_t* sprite, uint8_t transform, uint8_t scale) {
+    uint24_t width = sprite->width * scale;
+    uint24_t height = sprite->height * scale;
+    uint24_t size = 2 + width * height;
+    uint8_t steps = janus_CountTransformSteps(transform,scale);
+    /* A scratch copy to transform back and forth with is only needed for more than one step */
+    uint24_t needed = steps > 1 ? size * 2 : size;
+    gfx_sprite_t* buffers[2];
+    const gfx_sprite_t* current = sprite;
+    /* Start in whichever buffer makes the last step land in buffers[0], so the result never needs copying */
+    uint8_t next = (steps - 1) & 1;
+    struct janus_TransformedSprite* entry;
+
+    cache->misses++;
+    while(cache->spriteCount > 0 && (cache->spriteCount == JANUS_TRANSFORM_CACHE_ENTRIES || cache->bytesUsed + needed > JANUS_TRANSFORM_CACHE_BYTES)) {
+        janus_EvictTransformedSprite(cache);
+    }
+    buffers[0] = (gfx_sprite_t*)&cache->memory[cache->bytesUsed];
+    buffers[1] = (gfx_sprite_t*)&cache->memory[cache->bytesUsed + size];
+
+    if(scale != 1) {
+        buffers[next]->width = width;
+        buffers[next]->height = height;
+        current = gfx_ScaleSprite(current,buffers[next]);
+        next ^= 1;
+    }
+    if(transform & JANUS_TRANSFORM_MIRROR) {
+        current = gfx_FlipSpriteY(current,buffers[next]);
+        next ^= 1;
+    }
+    if(transform & JANUS_TRANSFORM_FLIP) {
+        current = gfx_FlipSpriteX(current,buffers[next]);
+        next ^= 1;
+    }
+    if(transform & JANUS_TRANSFORM_ROTATE_C) {
+        current = gfx_RotateSpriteC(current,buffers[next]);
+        next ^= 1;
+    }
+    if(transform & JANUS_TRANSFORM_ROTATE_CC) {
+        current = gfx_RotateSpriteCC(current,buffers[next]);
+        next ^= 1;
+    }
+    if(transform & JANUS_TRANSFORM_ROTATE_HALF) {
+        current = gfx_RotateSpriteHalf(current,buffers[next]);
+        next ^= 1;
+    }
+    /* Only an untransformed copy is left to make */
+    if(steps == 0) {
+        memcpy(buffers[0],current,size);
+    }
+
+    entry = &cache->sprites[cache->spriteCount++];
+    entry->source = source;
+    entry->offset = cache->bytesUsed;
+    entry->size = size;
+    entry->lastUsed = cache->uses;
+    entry->transform = transform;
+    entry->scale = scale;
+    cache->bytesUsed += size;
+    return buffers[0];
+}
+
+gfx_sprite_t* janus_GetTransformedSprite(struct janus_TransformCache* cache, const gfx_sprite_t* sprite, uint8_t transform, uint8_t scale) {
+    gfx_sprite_t* cached;
+    /* Checked before the lookup is counted so uses stays hits + misses */
+    if(!janus_CanTransformSprite(sprite->width,sprite->height,transform,scale)) {
+        return NULL;
+    }
+    cached = janus_FindTransformedSprite(cache,sprite,transform,scale);
+    return cached != NULL ? cached : janus_AddTransformedSprite(cache,sprite,sprite,transform,scale);
+}
+gfx_sprite_t* janus_GetTransformedAnimationPlayerFrame(struct janus_AnimationPlayer* player, struct janus_TransformCache* cache, uint8_t transform, uint8_t scale) {
+    const struct janus_AnimationClip* clip = player->clip;
+    /* Key compressed frames on their compressed data, since frame cache slots get reused for other frames */
+    const void* source = clip->frames != NULL ? (const void*)clip->frames[player->currentFrame] : (const void*)clip->compressedFrames[player->currentFrame];
+    /* Sprites and compressed frames both start with their width and height */
+    const uint8_t* size = source;
+    gfx_sprite_t* cached;
+    /* Checked before the lookup is counted, including whether the frame cache can decompress it, so uses stays hits + misses */
+    if(!janus_CanTransformSprite(size[0],size[1],transform,scale) || (clip->frames == NULL && size[0] * size[1] > JANUS_FRAME_CACHE_MAX_PIXELS)) {
+        return NULL;
+    }
+    cached = janus_FindTransformedSprite(cache,source,transform,scale);
+    if(cached != NULL) {
+        return cached;
+    }
+    return janus_AddTransformedSprite(cache,source,janus_GetAnimationPlayerFrame(player),transform,scale);
+}
+
+void janus_InitFrameCache(struct janus_FrameCache* cache) {
+    uint8_t i;
+    for(i = 0; i < JANUS_FRAME_CACHE_SLOTS; i++) {
+        cache->sources[i] = NULL;
+        cache->lastUsed[i] = 0;
+    }
+    cache->uses = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+}
+gfx_sprite_t* janus_GetCachedFrame(struct janus_FrameCache* cache, const uint8_t* compressed) {
+    uint8_t i, oldest = 0;
+    /* Only hand-made data can be this big; janus_CompressSprite(...) refuses it. Left out of the counters so uses stays hits + misses */
+    if(compressed[0] * compressed[1] > JANUS_FRAME_CACHE_MAX_PIXELS) {
+        return NULL;
+    }
+    cache->uses++;
+    for(i = 0; i < JANUS_FRAME_CACHE_SLOTS; i++) {
+        if(cache->sources[i] == compressed) {
+            cache->hits++;
+            cache->lastUsed[i] = cache->uses;
+            return (gfx_sprite_t*)cache->slots[i];
+        }
+        /* Empty slots were last used at 0, so they are picked first */
+        if(cache->lastUsed[i] < cache->lastUsed[oldest]) {
+            oldest = i;
+        }
+    }
+    cache->misses++;
+    cache->sources[oldest] = compressed;
+    cache->lastUsed[oldest] = cache->uses;
+    return janus_DecompressSprite(compressed,(gfx_sprite_t*)cache->slots[oldest]);
+}
+
+
+/* Evaluates a + t(b + t(c + td)) with t in 0-(1 << JANUS_PATH_T_SHIFT) */
+static int24_t janus_EvaluateCubic(int32_t a, int32_t b, int32_t c, int32_t d, int24_t t) {
+    int32_t value = d;
+    value = ((value * t) >> JANUS_PATH_T_SHIFT) + c;
+    value = ((value * t) >> JANUS_PATH_T_SHIFT) + b;
+    value = ((value * t) >> JANUS_PATH_T_SHIFT) + a;
+    return value;
+}
+
+bool janus_BuildPath(struct janus_Path* path, enum janus_PathType type, struct janus_Vector2* points, uint8_t pointCount) {
+    uint8_t segmentCount, samplesPerSegment, segment, sample, i;
+    struct janus_Vector2* segmentPoints[4];
+    int32_t coefficients[2][4];
+    uint32_t squaredLength;
+    uint24_t length;
+    int24_t t, dx, dy;
+
+    path->sampleCount = 0;
+    path->length = 0;
+    if(pointCount < 2 || (type == BEZIER && (pointCount - 1) % 3 != 0)) {
+        return false;
+    }
+    segmentCount = type == BEZIER ? (pointCount - 1) / 3 : pointCount - 1;
+    samplesPerSegment = (JANUS_PATH_MAX_SAMPLES - 1) / segmentCount;
+    if(samplesPerSegment == 0) {
+        return false;
+    }
+
+    for(segment = 0; segment < segmentCount; segment++) {
+        if(type == BEZIER) {
+            for(i = 0; i < 4; i++) {
+                segmentPoints[i] = &points[segment * 3 + i];
+            }
+        } else {
+            /* Catmull-Rom needs a point on either side of the segment; the ends reuse their own point */
+            segmentPoints[0] = &points[segment > 0 ? segment - 1 : segment];
+            segmentPoints[1] = &points[segment];
+            segmentPoints[2] = &points[segment + 1];
+            segmentPoints[3] = &points[segment + 2 < pointCount ? segment + 2 : segment + 1];
+        }
+        for(i = 0; i < 2; i++) {
+            int32_t v0 = i ? segmentPoints[0]->y : segmentPoints[0]->x;
+            int32_t v1 = i ? segmentPoints[1]->y : segmentPoints[1]->x;
+            int32_t v2 = i ? segmentPoints[2]->y : segmentPoints[2]->x;
+            int32_t v3 = i ? segmentPoints[3]->y : segmentPoints[3]->x;
+            if(type == CATMULL_ROM) {
+                /* Doubled so they stay whole numbers; halved after evaluating */
+                coefficients[i][0] = 2 * v1;
+                coefficients[i][1] = v2 - v0;
+                coefficients[i][2] = 2 * v0 - 5 * v1 + 4 * v2 - v3;
+                coefficients[i][3] = -v0 + 3 * v1 - 3 * v2 + v3;
+            } else if(type == BEZIER) {
+                coefficients[i][0] = v0;
+                coefficients[i][1] = 3 * (v1 - v0);
+                coefficients[i][2] = 3 * v0 - 6 * v1 + 3 * v2;
+                coefficients[i][3] = -v0 + 3 * v1 - 3 * v2 + v3;
+            } else {
+                coefficients[i][0] = v1;
+                coefficients[i][1] = v2 - v1;
+                coefficients[i][2] = 0;
+                coefficients[i][3] = 0;
+            }
+        }
+        /* Every segment but the last leaves its end sample to the next segment's start */
+        for(sample = 0; sample < samplesPerSegment + (segment == segmentCount - 1 ? 1 : 0); sample++) {
+            struct janus_Vector2* point = &path->samples[path->sampleCount++];
+            t = ((int24_t)sample << JANUS_PATH_T_SHIFT) / samplesPerSegment;
+            point->x = janus_EvaluateCubic(coefficients[0][0],coefficients[0][1],coefficients[0][2],coefficients[0][3],t);
+            point->y = janus_EvaluateCubic(coefficients[1][0],coefficients[1][1],coefficients[1][2],coefficients[1][3],t);
+            if(type == CATMULL_ROM) {
+                point->x >>= 1;
+                point->y >>= 1;
+            }
+        }
+    }
+
+    path->distances[0] = 0;
+    for(i = 1; i < path->sampleCount; i++) {
+        dx = path->samples[i].x - path->samples[i - 1].x;
+        dy = path->samples[i].y - path->samples[i - 1].y;
+        squaredLength = (uint32_t)((int32_t)dx * dx) + (uint32_t)((int32_t)dy * dy);
+        length = janus_SquareRoot(squaredLength);
+        /* Round to nearest; samples are only a few pixels apart, so rounding down would shorten the path noticeably */
+        if(squaredLength - (uint32_t)length * length > length) {
+            length++;
+        }
+        path->inverseLengths[i - 1] = length > 0 ? (uint16_t)(((uint32_t)1 << 16) / length - (length == 1 ? 1 : 0)) : 0;
+        path->distances[i] = path->distances[i - 1] + length;
+    }
+    path->inverseLengths[path->sampleCount - 1] = 0;
+    path->length = path->distances[path->sampleCount - 1];
+    return true;
+}
+struct janus_Vector2 janus_SamplePath(struct janus_Path* path, int24_t distance) {
+    uint8_t low = 0, high, middle;
+    int24_t into;
+    struct janus_Vector2* from;
+    struct janus_Vector2* to;
+    if(path->sampleCount == 0) {
+        return (struct janus_Vector2){0,0};
+    }
+    if(distance <= 0) {
+        return path->samples[0];
+    }
+    if((uint24_t)distance >= path->length) {
+        return path->samples[path->sampleCount - 1];
+    }
+    /* Binary search for the last sample at or before distance */
+    high = path->sampleCount - 1;
+    while(high - low > 1) {
+        middle = (low + high) >> 1;
+        if(path->distances[middle] <= (uint24_t)distance) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    from = &path->samples[low];
+    to = &path->samples[low + 1];
+    into = ((uint32_t)(distance - path->distances[low]) * path->inverseLengths[low]) >> 8;
+    return (struct janus_Vector2){
+        from->x + (int24_t)(((int32_t)(to->x - from->x) * into) >> 8),
+        from->y + (int24_t)(((int32_t)(to->y - from->y) * into) >> 8)
+    };
+}
+struct janus_Vector2 janus_SamplePathEased(struct janus_Path* path, enum janus_EasingMode easingMode, uint24_t alpha) {
+    return janus_SamplePath(path,JANUS_APPLY_DELTA_TIME((int24_t)path->length,janus_GetEaseProgress(easingMode,alpha)));
+}
+
+/* Moves a UI's cursor for the arrow keys set in arrowKeys (kb_Data[7] bits) */
+static void janus_MoveQuickUICursor(struct janus_QuickUI* ui, uint8_t arrowKeys) {
+    if(arrowKeys & kb_Down && ui->cursorPosition + 1 != JANUS_QUICKUI_MAX_OPTIONS/2 && ui->cursorPosition + 1 < ui->numberOfOptions) {
+        ui->cursorPosition++;
+    } else if(arrowKeys & kb_Up && ui->cursorPosition - 1 != (JANUS_QUICKUI_MAX_OPTIONS/2) - 1 && ui->cursorPosition > 0 ) {
+        ui->cursorPosition--;
+    } else if(arrowKeys & kb_Right && ui->cursorPosition < JANUS_QUICKUI_MAX_OPTIONS/2 && ui->cursorPosition + JANUS_QUICKUI_MAX_OPTIONS / 2 < ui->numberOfOptions) {
+        ui->cursorPosition += JANUS_QUICKUI_MAX_OPTIONS/2;
+    } else if(arrowKeys & kb_Left && ui->cursorPosition >= JANUS_QUICKUI_MAX_OPTIONS/2) {
+        ui->cursorPosition -= JANUS_QUICKUI_MAX_OPTIONS/2;
+    }
+}
+
+bool janus_UpdateQuickUI(struct janus_QuickUI* ui) {
+    janus_MoveQuickUICursor(ui,janus_PressedKeys[7]);
+    if(janus_ReleasedKeys[6] & kb_Enter) {
+        return true;
+    }
+    return false;
+}
+bool janus_HandleQuickUIEvent(struct janus_QuickUI* ui, struct janus_InputEvent* event) {
+    if(event->group == 7 && event->type != JANUS_INPUT_UP) {
+        janus_MoveQuickUICursor(ui,event->key);
+    }
+    return event->group == 6 && event->key == kb_Enter && event->type == JANUS_INPUT_UP;
+}
+
+/* Measures the buttons again if the options or layout style changed since the last time */
+static void janus_LayoutQuickUI(struct janus_QuickUI* ui) {
+    uint8_t i, j;
+    uint24_t largestWidthFirstColumn = 0;
+    uint24_t textWidths[JANUS_QUICKUI_MAX_OPTIONS];
+
+    if(ui->layoutCached && ui->cachedLayoutStyle == ui->layoutStyle && ui->cachedNumberOfOptions == ui->numberOfOptions) {
+        for(i = 0; i < ui->numberOfOptions && ui->cachedOptions[i] == ui->options[i]; i++);
+        if(i == ui->numberOfOptions) {
+            return;
+        }
+    }
+
+    gfx_SetTextScale(1,1);
+    /* Every string is measured once here; the layout styles below only read textWidths */
+    for(i = 0; i < ui->numberOfOptions; i++) {
+        textWidths[i] = gfx_GetStringWidth(ui->options[i]);
+        ui->buttonWidth[i] = textWidths[i] + (JANUS_QUICKUI_PADDING*2);
+        ui->buttonY[i] = JANUS_QUICKUI_PADDING + JANUS_QUICKUI_BUTTONS_Y_OFFSET + ((JANUS_QUICKUI_BUTTON_HEIGHT+JANUS_QUICKUI_PADDING) * (i % (JANUS_QUICKUI_MAX_OPTIONS/2)));
+        if(i < JANUS_QUICKUI_MAX_OPTIONS/2 && ui->buttonWidth[i] > largestWidthFirstColumn) {
+            largestWidthFirstColumn = ui->buttonWidth[i];
+        }
+        ui->cachedOptions[i] = ui->options[i];
+    }
+    for(i = 0; i < ui->numberOfOptions; i++) {
+        ui->buttonX[i] = JANUS_QUICKUI_PADDING;
+        if(i < JANUS_QUICKUI_MAX_OPTIONS/2) {
+            continue;
+        }
+        /* UI Layout Styles*/
+        if(ui->layoutStyle == STACK) {
+            ui->buttonX[i] += textWidths[i-(JANUS_QUICKUI_MAX_OPTIONS/2)] + JANUS_QUICKUI_PADDING*4;
+        } else if(ui->layoutStyle == UNIFORM) {
+            ui->buttonX[i] += largestWidthFirstColumn + (JANUS_QUICKUI_PADDING*4);
+        } else if(ui->layoutStyle == ELASTIC) {
+            uint24_t avg = 0;
+            for(j = janus_Max(i-1,JANUS_QUICKUI_MAX_OPTIONS/2); j <= janus_Min(i + 1,JANUS_QUICKUI_MAX_OPTIONS-1); j++) {
+                avg += textWidths[j-(JANUS_QUICKUI_MAX_OPTIONS/2)];
+            }
+            ui->buttonX[i] += avg/3 + largestWidthFirstColumn/2 + (JANUS_QUICKUI_PADDING*4);
+        }
+        /* End UI Layout Styles */
+    }
+    ui->cachedLayoutStyle = ui->layoutStyle;
+    ui->cachedNumberOfOptions = ui->numberOfOptions;
+    ui->layoutCached = true;
+}
+
+void janus_GetQuickUIButtonRect(struct janus_QuickUI* ui, uint8_t option, struct janus_Rect* rect) {
+    janus_LayoutQuickUI(ui);
+    rect->position.x = ui->xOffset + ui->buttonX[option];
+    rect->position.y = ui->yOffset + ui->buttonY[option];
+    rect->size.x = ui->buttonWidth[option];
+    rect->size.y = JANUS_QUICKUI_BUTTON_HEIGHT;
+    rect->layer = rect->mask = 0;
+}
+
+void janus_RenderQuickUI(struct janus_QuickUI* ui) {
+    uint8_t i;
+
+    janus_LayoutQuickUI(ui);
+
+    gfx_SetTextFGColor(ui->foregroundColor);
+    gfx_SetTextScale(2,2);
+    
+    gfx_PrintStringXY(ui->title,ui->xOffset + JANUS_QUICKUI_PADDING,ui->yOffset + JANUS_QUICKUI_PADDING);
+    
+    gfx_SetTextScale(1,1);
+    for(i = 0; i < ui->numberOfOptions; i++) {
+        uint24_t x = ui->xOffset + ui->buttonX[i];
+        uint24_t w = ui->buttonWidth[i];
+        uint8_t y = ui->yOffset + ui->buttonY[i];
+        uint8_t h = JANUS_QUICKUI_BUTTON_HEIGHT;
+        bool selecting;
 
         gfx_SetColor(ui->backgroundColor);
-        selecting = ui->cursorPosition == i && kb_Data[6] & kb_Enter;
+        selecting = ui->cursorPosition == i && janus_GetKeyGroup(6) & kb_Enter;
         if(ui->cursorPosition == i && !selecting) {
             //hovering button
             gfx_FillRectangle_NoClip(x - JANUS_QUICKUI_HOVER_OFFSET,y - JANUS_QUICKUI_HOVER_OFFSET,w,h);
@@ -12,8 +12,17 @@ extern "C" {
 #define JANUS_PI 3.1415926535f
 
 /* Timer macros */
-#define JANUS_TIMER_NUMBER 1
+/* clock() counts on timer 1 in current CE toolchains, and janus_GetDeltaTime(...) uses clock(), so the profiler and frame clock take timer 2 */
+/* Nothing else may reprogram this timer while they're in use; set it for the whole build, e.g. -DJANUS_TIMER_NUMBER=3 in CFLAGS, to move them */
+#ifndef JANUS_TIMER_NUMBER
+#define JANUS_TIMER_NUMBER 2
+#endif
 #define JANUS_TIMER_DIRECTION TIMER_UP
+#ifdef __TICE__
+#define JANUS_TIMER_TICKS_PER_US 48 // The profiler and frame clock count CPU cycles on the calculator
+#else
+#define JANUS_TIMER_TICKS_PER_US 1 // The profiler and frame clock count microseconds of a monotonic clock on a PC
+#endif
 
 /* Quick UI macros */
 #define JANUS_QUICKUI_MAX_OPTIONS 20
@@ -27,13 +36,138 @@ extern "C" {
 /* Animation Macros */
 #define JANUS_ANIMATION_MAX_FRAMES 64
 
+/* Physics World macros */
+#define JANUS_PHYSICS_MAX_OBJECTS 48 // Keep below 255; objects are referenced by uint8_t
+#define JANUS_PHYSICS_MAX_RECTS 48 // Keep below 255; rects are referenced by uint8_t
+#define JANUS_PHYSICS_CELL_SHIFT 5 // Cells are (1 << JANUS_PHYSICS_CELL_SHIFT) pixels wide and tall
+#define JANUS_PHYSICS_GRID_BITS 3 // The hash wraps every (1 << JANUS_PHYSICS_GRID_BITS) cells along each axis
+#define JANUS_PHYSICS_GRID_BUCKETS (1 << (JANUS_PHYSICS_GRID_BITS * 2))
+#define JANUS_PHYSICS_MAX_CELL_ENTRIES (JANUS_PHYSICS_MAX_OBJECTS * 4) // Object cell entries; objects that don't fit are tested against everything
+#define JANUS_PHYSICS_MAX_STATIC_ENTRIES (JANUS_PHYSICS_MAX_RECTS * 6) // Rect cell entries; rects that don't fit are tested against everything
+#define JANUS_PHYSICS_NO_ENTRY 0xFFFF
+#define JANUS_PHYSICS_MAX_TRIGGER_EVENTS 16 // Trigger overlaps recorded per janus_StepWorld(...)
+#define JANUS_SLEEP_DISTANCE 0 // World objects that move no more than this many pixels in a step count as still
+#define JANUS_SLEEP_FRAMES 30 // Steps an island has to stay still before it falls asleep
+
+/* Physics batch macros */
+#define JANUS_BATCH_MAX_OBJECTS 64 // Keep below 255; objects are referenced by uint8_t
+
+/* Sweep and prune macros */
+#define JANUS_SAP_MAX_OBJECTS 48 // Keep below 255; objects are referenced by uint8_t
+#define JANUS_SAP_MAX_PAIRS 96 // Size of the reusable pair buffer
+
 /* One second in milliseconds */
 #define JANUS_ONE_SECOND 1000
 
+/* Tween pool macros */
+#define JANUS_TWEEN_MAX_TWEENS 64 // Keep below 255; tweens are referenced by uint8_t handles
+#define JANUS_TWEEN_NONE 0xFF // Handle returned when the pool is full, and the next handle of a tween with nothing chained
+#define JANUS_TWEEN_ALPHA_SHIFT 12 // Precision of each tween's cached alpha per millisecond
+
+/* Compressed frame macros */
+#define JANUS_FRAME_CACHE_SLOTS 8 // Decompressed frames kept at once by a janus_FrameCache
+#define JANUS_FRAME_CACHE_MAX_PIXELS 1024 // Largest frame (width * height) a janus_FrameCache slot can hold
+
+/* Input event macros */
+#define JANUS_INPUT_MAX_EVENTS 32 // Events a janus_InputQueue holds before new ones are dropped
+#define JANUS_INPUT_DOWN 0 // Key was pressed
+#define JANUS_INPUT_UP 1 // Key was released
+#define JANUS_INPUT_REPEAT 2 // Key has been held long enough to auto-repeat
+
+/* Profiler macros */
+/* Define as 0 to leave the profiler out of the build; JANUS_PROFILE_BEGIN(...) and JANUS_PROFILE_END(...) then compile to nothing */
+/* janus.c has to see the same value, so set it for the whole build, e.g. -DJANUS_PROFILER=0 in CFLAGS */
+#ifndef JANUS_PROFILER
+#define JANUS_PROFILER 1
+#endif
+#define JANUS_PROFILER_MAX_ZONES 8 // Zones are numbered 0 to JANUS_PROFILER_MAX_ZONES - 1
+#define JANUS_PROFILER_HISTORY 32 // Frames of zone timings kept for min/avg/max
+#define JANUS_PROFILER_NUMBER_WIDTH 40 // Width of each of the overlay's avg/max columns
+
+/* Frame clock macros */
+#define JANUS_FRAME_CLOCK_WINDOW 64 // Frame times kept for janus_GetFrameStats(...)
+
+/* Input recording macros */
+#define JANUS_RECORDING_START_BYTES (KB_DATA_SIZE - 1) // A recording starts with janus_UpdateDebouncedKeys(...)'s key groups 1-7 as they were, then the frames
+#define JANUS_RECORDING_RUN 0x80 // Recording header bit: (header & 0x7F) + 1 more frames the same as the last one
+#define JANUS_RECORDING_KEYS 0x01 // Recording header bit: a byte of changed kb_Data groups follows, then each changed group
+#define JANUS_RECORDING_DELTA 0x02 // Recording header bit: a new 16-bit delta time follows, low byte first
+#define JANUS_HASH_START 0x1C9DC5 // Starting value for janus_HashBytes(...)
+
+/* Sprite transform macros */
+#define JANUS_TRANSFORM_CACHE_BYTES 12800 // Memory a janus_TransformCache may use for transformed sprites; holds two 4x scaled 16x16 sprites plus the scratch copy needed while making one
+#define JANUS_TRANSFORM_CACHE_ENTRIES 24 // Transformed sprites a janus_TransformCache keeps at once
+#define JANUS_TRANSFORM_MIRROR 0x01 // Mirror left to right (gfx_FlipSpriteY)
+#define JANUS_TRANSFORM_FLIP 0x02 // Flip upside down (gfx_FlipSpriteX)
+#define JANUS_TRANSFORM_ROTATE_C 0x04 // Quarter turn clockwise (gfx_RotateSpriteC)
+#define JANUS_TRANSFORM_ROTATE_CC 0x08 // Quarter turn counterclockwise (gfx_RotateSpriteCC)
+#define JANUS_TRANSFORM_ROTATE_HALF 0x10 // Half turn (gfx_RotateSpriteHalf)
+
+/* Path macros */
+#define JANUS_PATH_MAX_SAMPLES 65 // Keep below 255; points stored along a janus_Path, shared between its segments
+#define JANUS_PATH_T_SHIFT 8 // Precision of the curve parameter while building a janus_Path
+
+/* Easing macros */
+/* Define an easing family as 0 to leave its table out of the build; its modes then act like LINEAR */
+/* janus.c has to see the same value, so set it for the whole build, e.g. -DJANUS_EASE_ELASTIC=0 in CFLAGS */
+#ifndef JANUS_EASE_CUBIC
+#define JANUS_EASE_CUBIC 1
+#endif
+#ifndef JANUS_EASE_SINE
+#define JANUS_EASE_SINE 1
+#endif
+#ifndef JANUS_EASE_BACK
+#define JANUS_EASE_BACK 1
+#endif
+#ifndef JANUS_EASE_ELASTIC
+#define JANUS_EASE_ELASTIC 1
+#endif
+#ifndef JANUS_EASE_BOUNCE
+#define JANUS_EASE_BOUNCE 1
+#endif
+
+/* Fixed point physics macros */
+#define JANUS_FIXED_SHIFT 8 // Fixed point values are 16.8; 256 is one pixel
+#define JANUS_FIXED_ONE (1 << JANUS_FIXED_SHIFT)
+#define JANUS_FIXED_TIME_SHIFT 10 // Fixed point velocities are per 1024 milliseconds so delta time is a multiply and a shift
+#define JANUS_FIXED_SECOND (1 << JANUS_FIXED_TIME_SHIFT)
+#define JANUS_FIXED_MAX_RESISTANCE 15 // Largest resistance a janus_FixedPhysicsObject may have
+#define JANUS_FIXED_RECIPROCAL_SHIFT 12 // Precision of the resistance reciprocal table
+
+/* Integer math macros */
+#define JANUS_RECIPROCAL_BITS 20 // Precision of janus_Reciprocal multipliers; keeps the top 12 bits of a dividend times the multiplier within 32 bits
+
+/* Fixed point trig macros */
+#define JANUS_ANGLE_QUARTER 64 // Angles are uint8_t, so a full turn is 256 steps and wraps on its own
+#define JANUS_TRIG_SHIFT JANUS_FIXED_SHIFT // Sines and cosines are 16.8 fixed point, so 256 is 1
+#define JANUS_ATAN_SHIFT 6 // The atan table splits slopes from 0 to 1 into (1 << JANUS_ATAN_SHIFT) parts
+
+/* Collision layer macros */
+#define JANUS_LAYER_ALL 0xFF // Every layer; a layer or mask left at 0 counts as this
+
 /* Misc Helper Macros */
 
 #define JANUS_ABS(number) ((number > 0) ? (number) : -(number))
 
+/* Turns a janus_Rect layer or mask into the bits it stands for, treating 0 as JANUS_LAYER_ALL */
+#define JANUS_LAYER_BITS(layer) ((layer) ? (layer) : JANUS_LAYER_ALL)
+
+
+/* Profiler Macros */
+
+/**
+ * Starts timing a profiler zone; pair with JANUS_PROFILE_END(zone). Compiles to nothing when JANUS_PROFILER is 0
+ * 
+ * @example JANUS_PROFILE_BEGIN(ZONE_PHYSICS); janus_StepWorld(&world,deltaMS); JANUS_PROFILE_END(ZONE_PHYSICS);
+**/
+#if JANUS_PROFILER
+#define JANUS_PROFILE_BEGIN(zone) janus_BeginProfilerZone(zone)
+#define JANUS_PROFILE_END(zone) janus_EndProfilerZone(zone)
+#else
+#define JANUS_PROFILE_BEGIN(zone) ((void)0)
+#define JANUS_PROFILE_END(zone) ((void)0)
+#endif
+
 
 /* Animation Initialization Macros */
 
@@ -55,6 +189,29 @@ extern "C" {
 #define JANUS_ANIMATION_INIT_VARIABLE_TIMING(...) .useVariableTimings = true, {.variableTimings = {__VA_ARGS__}}
 
 
+/* Fixed Point Helper Macros */
+
+/**
+ * Converts whole pixels to 16.8 fixed point
+ * 
+ * @example struct janus_Rect wall = {{JANUS_TO_FIXED(0),JANUS_TO_FIXED(140)},{JANUS_TO_FIXED(200),JANUS_TO_FIXED(10)}};
+**/
+#define JANUS_TO_FIXED(x) ((x) * JANUS_FIXED_ONE)
+
+/**
+ * Converts 16.8 fixed point to whole pixels (rounding down), e.g. for drawing
+**/
+#define JANUS_FROM_FIXED(x) ((x) >> JANUS_FIXED_SHIFT)
+
+/**
+ * Turns a janus_DampenVelocity style dampen value into the 0-256 "keep" factor used by janus_DampenFixedVelocity
+ * Use it with constants so the divide happens at compile time
+ * 
+ * @example janus_DampenFixedVelocity(&object,&(struct janus_Vector2){JANUS_FIXED_DAMPEN(3),JANUS_FIXED_DAMPEN(32)});
+**/
+#define JANUS_FIXED_DAMPEN(dampen) (JANUS_FIXED_ONE - JANUS_FIXED_ONE / (dampen))
+
+
 /* Time Helper Macros */
 
 /**
@@ -64,7 +221,34 @@ extern "C" {
  * @param x A variable for msElapsed to be appleid to.
  * @param msElapsed An int representing a number of milliseconds in delta time
 **/
-#define JANUS_APPLY_DELTA_TIME(x,msElapsed) (x*msElapsed/JANUS_ONE_SECOND)
+#define JANUS_APPLY_DELTA_TIME(x,msElapsed) janus_DivideByOneSecond((x)*(msElapsed))
+
+/* One named section of code timed by JANUS_PROFILE_BEGIN(...) and JANUS_PROFILE_END(...) */
+struct janus_ProfilerZone {
+    const char* name; // Shown by janus_RenderProfiler(...) and janus_DumpProfilerCSV(...); zones without a name are skipped
+    uint32_t start; // Tick count at the last JANUS_PROFILE_BEGIN(...)
+    uint32_t frameTicks; // Ticks spent in the zone so far this frame
+};
+
+/* Zone timings for the last JANUS_PROFILER_HISTORY frames */
+struct janus_Profiler {
+    struct janus_ProfilerZone zones[JANUS_PROFILER_MAX_ZONES];
+    uint32_t history[JANUS_PROFILER_HISTORY][JANUS_PROFILER_MAX_ZONES]; // Ring buffer of ticks spent in each zone per frame
+    uint8_t historyHead; // Where the next frame goes in history
+    uint8_t historyCount; // Frames of history filled so far
+    uint24_t frameCount; // Frames ended with janus_EndProfilerFrame(...)
+};
+
+/* Per-frame time spent in one zone over the profiler's history, in microseconds */
+struct janus_ProfilerStats {
+    uint24_t minimum;
+    uint24_t average;
+    uint24_t maximum;
+};
+
+#if JANUS_PROFILER
+extern struct janus_Profiler janus_Profiler;
+#endif
 
 extern uint8_t janus_ReleasedKeys[KB_DATA_SIZE];
 extern uint8_t janus_PressedKeys[KB_DATA_SIZE];
@@ -74,11 +258,26 @@ enum janus_EasingMode {
     LINEAR, //No easing
     QUAD_IN, //Ease into motion
     QUAD_OUT, //Ease out of motion
-    QUAD_IN_OUT //Ease into and out of motion
+    QUAD_IN_OUT, //Ease into and out of motion
+    CUBIC_IN, //Like QUAD_IN, but sharper
+    CUBIC_OUT,
+    CUBIC_IN_OUT,
+    SINE_IN, //Like QUAD_IN, but gentler
+    SINE_OUT,
+    SINE_IN_OUT,
+    BACK_IN, //Pulls back a little before moving
+    BACK_OUT, //Overshoots a little before settling
+    BACK_IN_OUT,
+    ELASTIC_IN, //Winds up like a spring
+    ELASTIC_OUT, //Springs past the end and wobbles into place
+    ELASTIC_IN_OUT,
+    BOUNCE_IN,
+    BOUNCE_OUT, //Bounces to a stop at the end like a dropped ball
+    BOUNCE_IN_OUT
 };
 
 struct janus_Ease {
-    enum janus_EasingMode easingMode; // LINEAR, QUAD_IN, QUAD_OUT, or QUAD_IN_OUT
+    enum janus_EasingMode easingMode; // Any janus_EasingMode, e.g. LINEAR or QUAD_IN_OUT
     bool reverse; // Whether we are reversing the ease (To -> From instead of From -> To)
     int24_t fromX; // Start of ease X
     int24_t fromY; // Start of ease Y
@@ -90,6 +289,54 @@ struct janus_Ease {
     int24_t progress; // How far, in milliseconds, we are into the ease
 };
 
+/* Measures frame times in microseconds and optionally holds frames to a target rate; set up with janus_InitFrameClock(...) */
+struct janus_FrameClock {
+    uint32_t lastTicks; // Timer ticks at the end of the last janus_TickFrameClock(...)
+    uint32_t deadline; // Timer ticks the next frame is allowed to start at when limiting
+    uint32_t ticksPerFrame; // Timer ticks per frame at the target rate; 0 for no limit
+    uint24_t deltaUS; // Microseconds the last frame took, including any time spent waiting
+    int24_t deltaMS; // deltaUS in whole milliseconds, for anything taking deltaMS
+    uint24_t partialUS; // Microseconds left over from deltaMS so the millisecond deltas add up to the real time
+    uint24_t frameTimes[JANUS_FRAME_CLOCK_WINDOW]; // Ring buffer of the most recent frame times in microseconds
+    uint8_t head; // Where the next frame time goes in frameTimes
+    uint8_t count; // Frame times in frameTimes so far
+};
+
+/* Frame time statistics over a janus_FrameClock's window, in microseconds */
+struct janus_FrameStats {
+    uint24_t average;
+    uint24_t p95; // 95% of frames were this fast or faster
+    uint24_t p99; // 99% of frames were this fast or faster
+    uint24_t worst;
+    uint24_t fps; // Frames per second from the average
+};
+
+/* One tween in a janus_TweenPool; started with janus_StartTween(...) */
+struct janus_Tween {
+    int24_t* target; // Value written on every janus_UpdateTweens(...)
+    int24_t from; // Start of tween
+    int24_t change; // End of tween minus start of tween
+    int24_t length; // How long the tween lasts in milliseconds
+    int24_t progress; // How far, in milliseconds, we are into the tween
+    int24_t alphaPerMS; // (1000 << JANUS_TWEEN_ALPHA_SHIFT) / length, cached so updates never divide
+    enum janus_EasingMode easingMode;
+    uint8_t handle; // Handle janus_StartTween(...) returned for this tween
+    uint8_t next; // Handle of the tween chained after this one, or JANUS_TWEEN_NONE
+    bool waiting; // Chained tweens wait until the tween before them finishes
+    bool yoyo; // Plays back and forth until cancelled instead of finishing
+    bool reverse; // Whether a yoyo tween is currently heading back to from
+};
+
+/* Fixed-capacity pool of tweens that are all updated in one pass */
+struct janus_TweenPool {
+    struct janus_Tween tweens[JANUS_TWEEN_MAX_TWEENS]; // Live tweens, kept packed at the front; finished ones are swapped out
+    uint8_t tweenCount; // Number of live tweens, including waiting ones
+    /* Internal handle bookkeeping, managed by janus_StartTween(...) and janus_UpdateTweens(...) */
+    uint8_t indices[JANUS_TWEEN_MAX_TWEENS]; // Where each handle's tween sits in tweens, or JANUS_TWEEN_NONE if the handle is free
+    uint8_t freeHandles[JANUS_TWEEN_MAX_TWEENS]; // Stack of unused handles
+    uint8_t freeCount;
+};
+
 union janus_FrameTiming {
     uint24_t variableTimings[JANUS_ANIMATION_MAX_FRAMES]; //Array of millisecond timings per frame
     uint24_t constantTiming; //Millisecond timings for every frame
@@ -103,6 +350,102 @@ struct janus_Animation {
     bool loop; // Whether or not to loop animation
     uint24_t msElapsed; // Current progress (in milliseconds) of the animation; initialize at zero for most cases
     uint24_t currentFrame; // Current frame in the animation; initialize at zero for most cases
+    uint24_t frameStart; // When currentFrame starts (in milliseconds); reset to zero along with msElapsed and currentFrame
+    uint24_t length; // Total length in milliseconds, cached by janus_UpdateAnimation(...); set back to zero after changing frameCount or timings
+};
+
+/* Fixed-size least-recently-used cache of frames decompressed with janus_DecompressSprite(...) */
+struct janus_FrameCache {
+    const uint8_t* sources[JANUS_FRAME_CACHE_SLOTS]; // Compressed frame each slot holds, or NULL if empty
+    uint24_t lastUsed[JANUS_FRAME_CACHE_SLOTS]; // Value of uses when each slot was last handed out
+    uint24_t uses; // Counts lookups; the slot with the oldest lastUsed is replaced on a miss
+    uint24_t hits; // Lookups that found their frame already decompressed
+    uint24_t misses; // Lookups that had to decompress; if this keeps climbing, raise JANUS_FRAME_CACHE_SLOTS
+    uint8_t slots[JANUS_FRAME_CACHE_SLOTS][2 + JANUS_FRAME_CACHE_MAX_PIXELS]; // Decompressed gfx_sprite_t data
+};
+
+/* One key going down, coming up or repeating; group and key match kb_Data, e.g. group 7 and kb_Up */
+struct janus_InputEvent {
+    uint8_t group; // kb_Data index of the key
+    uint8_t key; // Bit of the key in its kb_Data group
+    uint8_t type; // JANUS_INPUT_DOWN, JANUS_INPUT_UP, or JANUS_INPUT_REPEAT
+    uint24_t time; // Clock time, in milliseconds, passed to janus_PollInput(...)
+};
+
+/* Ring buffer of key events, filled by comparing kb_Data with how it looked last poll */
+struct janus_InputQueue {
+    struct janus_InputEvent events[JANUS_INPUT_MAX_EVENTS];
+    uint8_t head; // Index of the oldest event
+    uint8_t eventCount;
+    uint24_t dropped; // Events lost because the queue was full
+    uint8_t lastKeys[KB_DATA_SIZE]; // kb_Data as of the last poll
+    uint24_t repeatDelays[KB_DATA_SIZE]; // Milliseconds a key in each group is held before it repeats
+    uint24_t repeatRates[KB_DATA_SIZE]; // Milliseconds between repeats in each group; 0 turns repeating off
+    uint8_t repeatKeys[KB_DATA_SIZE]; // Most recently pressed key in each group, which is the one that repeats
+    uint24_t nextRepeats[KB_DATA_SIZE]; // When each group's repeat key next repeats
+};
+
+/* A compact log of per-frame kb_Data and delta times, for recording a run and playing it back exactly */
+struct janus_InputRecording {
+    uint8_t* data; // Encoded frames; see the JANUS_RECORDING_ macros
+    uint24_t size; // Bytes of data used (recording) or available (replaying)
+    uint24_t capacity; // Bytes data can hold while recording
+    uint24_t position; // Where the next frame is read from while replaying
+    uint24_t frameCount; // Frames recorded or replayed so far
+    bool recording; // Set while janus_GetDeltaTime(...) is adding frames
+    bool replaying; // Set while janus_GetDeltaTime(...) is reading frames; clears itself at the end of the data
+    bool overflowed; // Recording stopped early because data was full
+    uint8_t keys[KB_DATA_SIZE]; // kb_Data of the last frame written (recording) or read (replaying)
+    int24_t deltaTime; // Delta time of the last frame written or read
+    uint8_t repeats; // Identical frames waiting to be written (recording) or still to be read (replaying)
+    uint8_t frameKeys[KB_DATA_SIZE]; // kb_Data as the frame being recorded first read it
+    int24_t frameDelta; // Delta time of the frame being recorded
+    bool frameOpen; // Set once janus_GetDeltaTime(...) has started a frame that isn't written yet
+    bool keysTaken; // Set once the frame being recorded has read the keypad
+};
+
+/* One transformed sprite in a janus_TransformCache */
+struct janus_TransformedSprite {
+    const void* source; // What the sprite was made from; a sprite, or a compressed frame for compressed clips
+    uint24_t offset; // Where the sprite is in the cache's memory
+    uint24_t size; // Bytes the sprite takes up
+    uint24_t lastUsed; // Value of uses when the sprite was last handed out
+    uint8_t transform; // JANUS_TRANSFORM_ flags
+    uint8_t scale; // Whole number scale
+};
+
+/* Scaled, mirrored and rotated sprites, made once and kept until they are the least recently used and space runs out */
+struct janus_TransformCache {
+    struct janus_TransformedSprite sprites[JANUS_TRANSFORM_CACHE_ENTRIES]; // Kept in the same order as their memory
+    uint8_t spriteCount;
+    uint24_t bytesUsed;
+    uint24_t uses; // Counts lookups
+    uint24_t hits; // Lookups served from the cache
+    uint24_t misses; // Lookups that had to transform a sprite
+    uint24_t evictions; // Sprites thrown out to make room; if this keeps climbing, raise JANUS_TRANSFORM_CACHE_BYTES or JANUS_TRANSFORM_CACHE_ENTRIES
+    uint8_t memory[JANUS_TRANSFORM_CACHE_BYTES];
+};
+
+/* The unchanging half of an animation, shared by every janus_AnimationPlayer that plays it; can be declared const */
+struct janus_AnimationClip {
+    gfx_sprite_t* const* frames; // Array of frameCount pointers to gfx_sprites
+    const uint24_t* frameTimings; // Array of frameCount millisecond timings, or NULL to give every frame constantTiming
+    uint24_t constantTiming; // Millisecond timing for every frame when frameTimings is NULL
+    uint24_t frameCount; // Number of frames
+    bool loop; // Whether or not to loop animation
+    const uint8_t* const* compressedFrames; // Used instead of frames when frames is NULL; frames made by janus_CompressSprite(...)
+    struct janus_FrameCache* cache; // Where compressedFrames are decompressed to; may be shared between clips
+};
+
+/* Playback state for one thing using a janus_AnimationClip */
+struct janus_AnimationPlayer {
+    const struct janus_AnimationClip* clip;
+    uint24_t msElapsed; // Current progress (in milliseconds) of the animation
+    uint24_t currentFrame; // Current frame in the animation
+    uint24_t speed; // Playback speed where JANUS_FIXED_ONE (256) is normal speed, 512 double speed, and so on
+    uint8_t partialMS; // Fraction of a millisecond carried between updates, in 256ths
+    uint24_t frameStart; // When currentFrame starts (in milliseconds), so updates carry on from it
+    uint24_t length; // Total length of clip in milliseconds, cached on the first update
 };
 
 /* Determines whether the second column of elements follows the countour of the first or is all on the same X position */
@@ -122,6 +465,14 @@ struct janus_QuickUI {
     uint8_t cursorPosition; // Position of cursor
     uint8_t numberOfOptions; //Number of options to be used (Don't exceed JANUS_QUICKUI_MAX_OPTIONS)
     char* options[JANUS_QUICKUI_MAX_OPTIONS]; //Array of option texts
+    /* Button layout, measured once and reused until layoutStyle, numberOfOptions or an options pointer changes; can be left zeroed */
+    bool layoutCached; // Set to false after changing an option's text in place so the layout is measured again
+    enum janus_QuickUILayoutStyle cachedLayoutStyle; // layoutStyle the layout was measured for
+    uint8_t cachedNumberOfOptions; // numberOfOptions the layout was measured for
+    char* cachedOptions[JANUS_QUICKUI_MAX_OPTIONS]; // Option texts the layout was measured for
+    uint24_t buttonX[JANUS_QUICKUI_MAX_OPTIONS]; // Button X positions, relative to xOffset so moving the UI doesn't need a new layout
+    uint8_t buttonY[JANUS_QUICKUI_MAX_OPTIONS]; // Button Y positions, relative to yOffset
+    uint24_t buttonWidth[JANUS_QUICKUI_MAX_OPTIONS]; // Button widths; every button is JANUS_QUICKUI_BUTTON_HEIGHT tall
 };
 
 struct janus_Vector2 {
@@ -129,9 +480,44 @@ struct janus_Vector2 {
     int24_t y;
 };
 
+/* Turns dividing by divisor into multiplying by multiplier and shifting right by shift; set up with janus_InitReciprocal(...) */
+struct janus_Reciprocal {
+    uint24_t divisor;
+    uint24_t multiplier; // About (1 << shift) / divisor, rounded down
+    uint8_t shift;
+};
+
+/* An ease that only remembers when it started, so its position can be worked out for any time with janus_EaseSampleAt(...) */
+struct janus_TimedEase {
+    enum janus_EasingMode easingMode;
+    struct janus_Vector2 from; // Start of ease
+    struct janus_Vector2 to; // End of ease
+    uint24_t startTime; // Clock time, in milliseconds, that the ease starts at
+    int24_t length; // How long the ease should be in milliseconds
+    int24_t alphaPerMS; // (1000 << JANUS_TWEEN_ALPHA_SHIFT) / length, set by janus_InitTimedEase(...)
+};
+
+/* How a janus_Path gets from one control point to the next */
+enum janus_PathType {
+    POLYLINE, // Straight lines between the points
+    CATMULL_ROM, // Smooth curve through every point
+    BEZIER // Cubic Bezier curves; every third point is passed through and the two between are handles, so there are 3n+1 points
+};
+
+/* A curve flattened into samples with a running arc-length table, so moving along it at a steady speed is a lookup and a lerp */
+struct janus_Path {
+    struct janus_Vector2 samples[JANUS_PATH_MAX_SAMPLES]; // Points along the curve
+    uint24_t distances[JANUS_PATH_MAX_SAMPLES]; // Distance along the path to each sample
+    uint16_t inverseLengths[JANUS_PATH_MAX_SAMPLES]; // 65536 / the length from each sample to the next, so lerping never divides
+    uint8_t sampleCount;
+    uint24_t length; // Total length of the path in pixels
+};
+
 struct janus_Rect {
     struct janus_Vector2 position;
     struct janus_Vector2 size;
+    uint8_t layer; // Bit(s) of the collision layers this rect is on; 0 puts it on every layer
+    uint8_t mask; // Bits of the layers this rect collides with; 0 collides with every layer
 };
 
 struct janus_PhysicsObject {
@@ -139,6 +525,118 @@ struct janus_PhysicsObject {
     struct janus_Vector2 velocity; //Velocity of object
     int24_t resistance; //How willing an object is to move against other physics objects. The higher the value, the more it will move when pushed by an object with lower value.
     bool anchored;
+    bool trigger; //Trigger objects are never pushed and never push other objects; janus_StepWorld(...) reports their overlaps in world->triggerEvents instead
+    struct janus_Vector2 previousPosition; //Position before the last janus_ApplyVelocity(...) or janus_StepWorld(...); used to interpolate rendering between steps
+    bool sleeping; //Set by janus_StepWorld(...) when the object and everything touching it have been still for JANUS_SLEEP_FRAMES steps; sleeping objects are skipped
+    uint8_t stillFrames; //Steps the object has been still for; used by janus_StepWorld(...)
+};
+
+/* Where and how a moving rect first touches another rect; filled by janus_SweepRect(...) */
+struct janus_SweepHit {
+    int24_t time; // How far (0 to 1000) along the movement the rects first touch
+    struct janus_Vector2 position; // Position of the moving rect at the time of impact
+    struct janus_Vector2 normal; // Side of the rect that was hit, as -1, 0 or 1 per axis; {0,-1} is the top of the rect (a floor)
+};
+
+/* Where a ray first hits something; filled by the raycast functions */
+struct janus_RayHit {
+    struct janus_Vector2 position; // Point where the ray hit
+    struct janus_Vector2 normal; // Side that was hit, as -1, 0 or 1 per axis; {0,0} if the ray started inside
+    int24_t distance; // How far (0 to 1000) along the ray the hit is
+    int24_t index; // Index of the rect that was hit, or tileY * width + tileX for tile maps; -1 if nothing was hit
+};
+
+struct janus_TileMap {
+    const uint8_t* solid; // One bit per tile, set for solid tiles. Each row starts on a new byte and the leftmost tile of a byte is its highest bit
+    uint24_t width; // Width of the map in tiles
+    uint24_t height; // Height of the map in tiles
+    uint8_t tileShift; // Tiles are (1 << tileShift) pixels wide and tall; e.g. 4 for 16x16 tiles
+    struct janus_Vector2 position; // Position of the map's top left corner
+    uint8_t layer; // Collision layer bit(s) every tile is on, like janus_Rect's layer; 0 puts the map on every layer
+};
+
+/* A janus_PhysicsObject that keeps subpixel positions and never divides */
+struct janus_FixedPhysicsObject {
+    struct janus_Rect rect; //Position and size of object in 16.8 fixed point (see JANUS_TO_FIXED)
+    struct janus_Vector2 velocity; //Velocity of object in 16.8 fixed point pixels per JANUS_FIXED_SECOND
+    uint8_t resistance; //Same as janus_PhysicsObject's resistance, from 0 to JANUS_FIXED_MAX_RESISTANCE; larger values act as JANUS_FIXED_MAX_RESISTANCE
+    bool anchored;
+};
+
+/* Runs physics at a fixed rate no matter how long frames take */
+struct janus_Timestep {
+    int24_t stepMS; // Milliseconds per physics step; e.g. JANUS_ONE_SECOND / 30 for 30 steps a second. Must be above 0 for any steps to run
+    uint8_t maxSteps; // Most steps to run for one frame; time past that is dropped so a slow frame can't snowball
+    int24_t accumulator; // Milliseconds waiting to be simulated; initialize at zero
+    int24_t alpha; // How far (0 to 1000) the frame is between the last two steps; pass it to janus_GetInterpolatedPosition(...)
+};
+
+struct janus_ObjectPair {
+    uint8_t object1; // Index of the first object
+    uint8_t object2; // Index of the second object
+};
+
+/* One link in a janus_PhysicsWorld hash bucket */
+struct janus_CellEntry {
+    uint8_t index; // Index into the world's objects or rects
+    uint16_t next; // Next entry in the same bucket, or JANUS_PHYSICS_NO_ENTRY
+};
+
+struct janus_PhysicsWorld {
+    struct janus_PhysicsObject objects[JANUS_PHYSICS_MAX_OBJECTS]; // Dynamic objects; add them with janus_AddWorldObject(...)
+    struct janus_Rect rects[JANUS_PHYSICS_MAX_RECTS]; // Static walls and floors; add them with janus_AddWorldRect(...)
+    bool onFloor[JANUS_PHYSICS_MAX_OBJECTS]; // Set by janus_StepWorld(...) when the matching object rests on a rect or another object
+    uint8_t objectCount; // Number of objects in use
+    uint8_t rectCount; // Number of rects in use
+    bool rectsChanged; // Set this to true after moving or resizing a rect so the static grid gets rebuilt (this also wakes every object)
+    struct janus_ObjectPair triggerEvents[JANUS_PHYSICS_MAX_TRIGGER_EVENTS]; // Trigger objects that overlapped another object during the last step
+    uint8_t triggerEventCount; // Number of trigger events from the last step
+    uint8_t awakeCount; // Number of objects janus_StepWorld(...) left awake
+    uint8_t sleepingCount; // Number of objects janus_StepWorld(...) left sleeping
+    struct janus_Vector2 gravity; // Added to every unanchored object's velocity once per step
+    struct janus_Vector2 dampen; // Applied like janus_DampenVelocity(...) at the end of a step; a zero component skips dampening on that axis
+
+    /* Internal broadphase state, managed by janus_StepWorld(...) */
+    uint16_t buckets[JANUS_PHYSICS_GRID_BUCKETS];
+    uint16_t staticBuckets[JANUS_PHYSICS_GRID_BUCKETS];
+    struct janus_CellEntry entries[JANUS_PHYSICS_MAX_CELL_ENTRIES];
+    struct janus_CellEntry staticEntries[JANUS_PHYSICS_MAX_STATIC_ENTRIES];
+    uint8_t overflowObjects[JANUS_PHYSICS_MAX_OBJECTS];
+    uint8_t overflowRects[JANUS_PHYSICS_MAX_RECTS];
+    uint8_t overflowObjectCount;
+    uint8_t overflowRectCount;
+    uint8_t islands[JANUS_PHYSICS_MAX_OBJECTS]; // Links each object towards the first object of its island (objects touching each other)
+};
+
+/* Physics objects stored as one array per field so a whole batch can be stepped in one tight loop */
+struct janus_PhysicsBatch {
+    int24_t x[JANUS_BATCH_MAX_OBJECTS]; // Position X of each object
+    int24_t y[JANUS_BATCH_MAX_OBJECTS]; // Position Y of each object
+    int24_t width[JANUS_BATCH_MAX_OBJECTS]; // Size X of each object
+    int24_t height[JANUS_BATCH_MAX_OBJECTS]; // Size Y of each object
+    int24_t velocityX[JANUS_BATCH_MAX_OBJECTS]; // Velocity X of each object
+    int24_t velocityY[JANUS_BATCH_MAX_OBJECTS]; // Velocity Y of each object
+    int24_t resistance[JANUS_BATCH_MAX_OBJECTS]; // Resistance of each object (see janus_PhysicsObject)
+    uint8_t anchored[(JANUS_BATCH_MAX_OBJECTS + 7) / 8]; // One bit per object, set if the object is anchored
+    uint8_t count; // Number of objects in use (Don't exceed JANUS_BATCH_MAX_OBJECTS)
+};
+
+/* One entry in the sweep and prune sorted list, cached from an object's rect */
+struct janus_SweepEndpoint {
+    int24_t minX; // Left edge of the object
+    int24_t maxX; // Right edge of the object
+    uint8_t index; // Index into the swept object array
+};
+
+struct janus_SweepAndPrune {
+    struct janus_PhysicsObject* objects; // Array of objects to sweep
+    uint8_t objectCount; // Number of objects in the array; change this whenever you add or remove objects (Don't exceed JANUS_SAP_MAX_OBJECTS)
+    uint8_t sortedCount; // Number of objects in the sorted list; janus_UpdateSweepAndPrune(...) rebuilds the list when this doesn't match objectCount
+    struct janus_SweepEndpoint endpoints[JANUS_SAP_MAX_OBJECTS]; // Objects sorted by left edge, kept between updates
+    struct janus_ObjectPair pairs[JANUS_SAP_MAX_PAIRS]; // Pairs found overlapping by the last update
+    uint24_t pairCount; // Number of pairs in the buffer
+    uint24_t pairsTested; // Pairs overlapping on X that were tested with janus_Collision(...) in the last update
+    uint24_t pairsOverlapping; // Pairs that actually overlapped in the last update; can exceed pairCount if the buffer filled up
 };
 
 /********************/
@@ -229,29 +727,126 @@ int24_t janus_LerpInt24(int24_t x, int24_t y, float alpha);
 **/ 
 int24_t janus_LerpInt24ByInt(int24_t x, int24_t y, int24_t alpha);
 
+/**
+ * Approximates sine
+ * 
+ * @param x radians
+ * @returns Sine of x radians
+ * @note Probably works, but if something breaks this function could be at fault
+ * @note Only covers 0 to pi and uses floats; janus_SinFixed(...) is much faster and covers a full turn
+**/ 
+float janus_Sin(float x);
+
+
+/****************/
+/* Integer Math */
+/****************/
+
 /**
  * Returns x to the yth power
  * 
  * @param x Base number
  * @param y Exponent
- * @returns x^y
+ * @returns x^y, or 1 if y is 0 or less
 **/ 
 int24_t janus_Pow(int24_t x, int24_t y);
 
 /**
- * Approximates sine
+ * Finds the square root of a number
  * 
- * @param x radians
- * @returns Sine of x radians
- * @note Probably works, but if something breaks this function could be at fault
-**/ 
-float janus_Sin(float x);
+ * @param value number to take the square root of
+ * @returns square root of value, rounded down
+**/
+uint24_t janus_SquareRoot(uint32_t value);
+
+/**
+ * Prepares a janus_Reciprocal so dividing by divisor becomes a couple of multiplies and shifts
+ * Costs one divide, so set up reciprocals once and reuse them
+ * 
+ * @param reciprocal reciprocal to fill in
+ * @param divisor number to divide by; must not be 0
+**/
+void janus_InitReciprocal(struct janus_Reciprocal* reciprocal, uint24_t divisor);
+
+/**
+ * Divides by a reciprocal's divisor without a software divide
+ * 
+ * @param value number to divide
+ * @param reciprocal reciprocal set up with janus_InitReciprocal(...)
+ * @returns value / divisor, rounded toward zero like the / operator
+**/
+int24_t janus_DivideByReciprocal(int24_t value, const struct janus_Reciprocal* reciprocal);
+
+/**
+ * Divides by JANUS_ONE_SECOND (1000) without a software divide
+ * 
+ * @param value number to divide
+ * @returns value / 1000, rounded toward zero like the / operator
+**/
+int24_t janus_DivideByOneSecond(int24_t value);
+
+
+/********************/
+/* Fixed Point Trig */
+/********************/
+
+/**
+ * Looks up the sine of an angle
+ * 
+ * @param angle 0-255, where 64 is a quarter turn
+ * @returns Sine of angle in 16.8 fixed point (-256 to 256)
+ * @example velocity.x = janus_CosFixed(aim) * speed >> JANUS_TRIG_SHIFT; velocity.y = janus_SinFixed(aim) * speed >> JANUS_TRIG_SHIFT;
+**/
+int24_t janus_SinFixed(uint8_t angle);
+
+/**
+ * Looks up the cosine of an angle
+ * 
+ * @param angle 0-255, where 64 is a quarter turn
+ * @returns Cosine of angle in 16.8 fixed point (-256 to 256)
+**/
+int24_t janus_CosFixed(uint8_t angle);
+
+/**
+ * Finds the angle pointing along (x, y), matching janus_CosFixed(...) and janus_SinFixed(...)
+ * 
+ * @param y Y component of the direction
+ * @param x X component of the direction
+ * @returns 0-255, where 64 is a quarter turn; 0 when x and y are both 0
+ * @note Costs one divide
+**/
+uint8_t janus_Atan2(int24_t y, int24_t x);
+
+/**
+ * Finds the length of a vector using an integer square root
+ * 
+ * @param vector vector to measure; components should stay within -32767 to 32767
+ * @returns length of vector, rounded down
+**/
+uint24_t janus_VectorLength(struct janus_Vector2* vector);
+
+/**
+ * Scales a vector so it points the same way but has the given length
+ * 
+ * @param vector vector to normalize; components should stay within -32767 to 32767
+ * @param length length of the result, e.g. JANUS_FIXED_ONE for a 16.8 unit vector
+ * @returns vector scaled to length, or {0,0} if vector has no length
+**/
+struct janus_Vector2 janus_NormalizeVector(struct janus_Vector2* vector, int24_t length);
 
 
 /***********************/
 /* Physics & Collision */
 /***********************/
 
+/**
+ * Returns whether two janus_Rect are on layers that collide with each other: each rect's layer has to be in the other's mask.
+ * The collision handlers check this before janus_Collision, so filtered pairs cost next to nothing.
+ * 
+ * @returns true if the two rects' layers and masks let them collide
+**/
+bool janus_LayersCollide(struct janus_Rect* object1, struct janus_Rect* object2);
+
 /**
  * Returns whether or not two janus_Rect are colliding
  * 
@@ -279,6 +874,120 @@ bool janus_HandleObjectObjectCollision(struct janus_PhysicsObject* object1, stru
  */
 bool janus_HandleObjectRectCollision(struct janus_PhysicsObject* object1, struct janus_Rect* rect);
 
+/**
+ * Sweeps a moving rect against a still one and finds the time of impact, so fast objects can't skip over thin walls
+ * 
+ * @param moving the rect that is moving
+ * @param movement how far the rect moves
+ * @param rect the rect it may run into
+ * @param hit filled with the time of impact, contact position and normal if there is a hit
+ * 
+ * @returns true if the rects touch somewhere along the movement; rects that already overlap don't count (use janus_HandleObjectRectCollision for those)
+ */
+bool janus_SweepRect(struct janus_Rect* moving, struct janus_Vector2* movement, struct janus_Rect* rect, struct janus_SweepHit* hit);
+
+/**
+ * Like janus_ApplyVelocity, but the object is swept against the rects and stops (or slides) at the first one it touches instead of passing through it.
+ * Use this in place of janus_ApplyVelocity and janus_HandleObjectRectCollision for fast objects or large time steps.
+ * 
+ * @param object object to move
+ * @param deltaMS milliseconds since the last call
+ * @param rects array of rects to sweep against
+ * @param rectCount number of rects in the array
+ * 
+ * @returns true if the object landed on top of a rect (good for jump logic)
+ */
+bool janus_ApplyVelocitySwept(struct janus_PhysicsObject* object, int24_t deltaMS, struct janus_Rect* rects, uint8_t rectCount);
+
+/**
+ * Casts a ray (a line segment) against one rect using the slab method
+ * 
+ * @param origin start of the ray
+ * @param ray offset from the start of the ray to its end
+ * @param rect rect to test
+ * @param hit filled with the hit point, normal and distance if there is a hit (index is left alone)
+ * 
+ * @returns true if the ray touches the rect before its end
+ */
+bool janus_RaycastRect(struct janus_Vector2* origin, struct janus_Vector2* ray, struct janus_Rect* rect, struct janus_RayHit* hit);
+
+/**
+ * Casts a ray against an array of rects and finds the nearest hit; good for line of sight checks
+ * 
+ * @param origin start of the ray
+ * @param ray offset from the start of the ray to its end
+ * @param rects array of rects to test
+ * @param rectCount number of rects in the array
+ * @param mask collision layers the ray can hit, like janus_Rect's mask; rects on none of them are skipped, and 0 hits every layer
+ * @param hit filled with the nearest hit; hit->index is -1 if nothing was hit
+ * 
+ * @returns true if the ray hit any rect (line of sight is blocked)
+ */
+bool janus_RaycastRects(struct janus_Vector2* origin, struct janus_Vector2* ray, struct janus_Rect* rects, uint8_t rectCount, uint8_t mask, struct janus_RayHit* hit);
+
+/**
+ * Casts many rays from one origin against an array of rects, e.g. for a vision cone. Each rect is loaded once and tested against every ray.
+ * 
+ * @param origin start of every ray
+ * @param rays array of offsets from the origin to the end of each ray
+ * @param rayCount number of rays
+ * @param rects array of rects to test
+ * @param rectCount number of rects in the array
+ * @param mask collision layers the rays can hit, as in janus_RaycastRects(...)
+ * @param hits array of rayCount hits, filled like janus_RaycastRects(...)
+ * 
+ * @returns number of rays that hit something
+ */
+uint8_t janus_RaycastRectsBatch(struct janus_Vector2* origin, struct janus_Vector2* rays, uint8_t rayCount, struct janus_Rect* rects, uint8_t rectCount, uint8_t mask, struct janus_RayHit* hits);
+
+/**
+ * Walks a ray through a tile map one tile at a time (a grid DDA) and stops at the first solid tile; only tiles along the ray are looked at
+ * 
+ * @param map tile map to cast against
+ * @param origin start of the ray
+ * @param ray offset from the start of the ray to its end
+ * @param hit filled with the hit; hit->index is -1 if nothing was hit
+ * 
+ * @returns true if the ray hit a solid tile
+ */
+bool janus_RaycastTileMap(struct janus_TileMap* map, struct janus_Vector2* origin, struct janus_Vector2* ray, struct janus_RayHit* hit);
+
+/**
+ * Casts many rays from one origin through a tile map
+ * 
+ * @param map tile map to cast against
+ * @param origin start of every ray
+ * @param rays array of offsets from the origin to the end of each ray
+ * @param rayCount number of rays
+ * @param hits array of rayCount hits, filled like janus_RaycastTileMap(...)
+ * 
+ * @returns number of rays that hit a solid tile
+ */
+uint8_t janus_RaycastTileMapBatch(struct janus_TileMap* map, struct janus_Vector2* origin, struct janus_Vector2* rays, uint8_t rayCount, struct janus_RayHit* hits);
+
+/**
+ * Returns whether a tile in a janus_TileMap is solid
+ *
+ * @param map tile map to check
+ * @param tileX column of the tile
+ * @param tileY row of the tile
+ *
+ * @returns true if the tile is solid; tiles outside of the map are never solid
+ */
+bool janus_IsTileSolid(struct janus_TileMap* map, int24_t tileX, int24_t tileY);
+
+/**
+ * Handles collisions between a physics object and a tile map, like calling janus_HandleObjectRectCollision against every solid tile.
+ * Only the tiles under the object are looked at, and edges shared by two solid tiles are ignored so adjacent tiles act like one merged surface (objects don't snag on seams).
+ * Objects whose rect.mask leaves out the map's layer pass straight through it.
+ *
+ * @param object1 the physics object to handle collisions for
+ * @param map the tile map the physics object is being tested with
+ *
+ * @returns true if object1 is standing on a solid tile (good for jump logic)
+ */
+bool janus_HandleObjectTileMapCollision(struct janus_PhysicsObject* object1, struct janus_TileMap* map);
+
 /**
  * Adds the given input to an object's velocity
  * 
@@ -304,6 +1013,199 @@ void janus_ApplyVelocity(struct janus_PhysicsObject* object, int24_t deltaMS);
  */
 void janus_DampenVelocity(struct janus_PhysicsObject* object, struct janus_Vector2* dampen);
 
+/***********************/
+/* Fixed Point Physics */
+/***********************/
+
+/**
+ * janus_HandleObjectObjectCollision for fixed point objects. Resistance ratios come from a reciprocal table, so there is no division.
+ * 
+ * @param object1 first object handling collisions
+ * @param object2 second obect handling collisions
+ * 
+ * @returns true if object1 is pushing on top of object2, treating 2 like a floor (good for making a player jump if true)
+ */
+bool janus_HandleFixedObjectObjectCollision(struct janus_FixedPhysicsObject* object1, struct janus_FixedPhysicsObject* object2);
+
+/**
+ * janus_HandleObjectRectCollision for fixed point objects
+ * 
+ * @param object1 the physics object to handle collisions for
+ * @param rect the rectangle the physics object is being tested with, in 16.8 fixed point
+ * 
+ * @returns true if object1 is pushing on top of the rect like a floor (good for jump logic)
+ */
+bool janus_HandleFixedObjectRectCollision(struct janus_FixedPhysicsObject* object1, struct janus_Rect* rect);
+
+/**
+ * Adds the given input to a fixed point object's velocity
+ * 
+ * @param object object to add the velocity to
+ * @param velocity velocity to add, in 16.8 fixed point pixels per JANUS_FIXED_SECOND
+ */
+void janus_AddFixedForce(struct janus_FixedPhysicsObject* object, struct janus_Vector2* velocity);
+
+/**
+ * janus_ApplyVelocity for fixed point objects. Scaling by delta time is a multiply and a shift, and slow objects still move by subpixels.
+ * 
+ * @param object object to move
+ * @param deltaMS milliseconds since the last call
+ */
+void janus_ApplyFixedVelocity(struct janus_FixedPhysicsObject* object, int24_t deltaMS);
+
+/**
+ * Scales a fixed point object's velocity by keep/256 on each axis. Build keep with JANUS_FIXED_DAMPEN to match janus_DampenVelocity.
+ * 
+ * @param object object to dampen
+ * @param keep how much velocity to keep per axis; 256 keeps all of it and 0 stops the object
+ */
+void janus_DampenFixedVelocity(struct janus_FixedPhysicsObject* object, struct janus_Vector2* keep);
+
+/*****************/
+/* Physics World */
+/*****************/
+
+/**
+ * Empties a physics world. Set gravity and dampen afterwards if you want them.
+ *
+ * @param world world to reset
+ */
+void janus_InitWorld(struct janus_PhysicsWorld* world);
+
+/**
+ * Copies a physics object into the world
+ *
+ * @param world world to add the object to
+ * @param object object to copy
+ * @returns pointer to the world's copy of the object, or NULL if the world already holds JANUS_PHYSICS_MAX_OBJECTS objects
+ */
+struct janus_PhysicsObject* janus_AddWorldObject(struct janus_PhysicsWorld* world, struct janus_PhysicsObject* object);
+
+/**
+ * Copies a static rect (wall, floor, platform) into the world
+ *
+ * @param world world to add the rect to
+ * @param rect rect to copy
+ * @returns pointer to the world's copy of the rect, or NULL if the world already holds JANUS_PHYSICS_MAX_RECTS rects
+ * @note If you move the returned rect later, set world->rectsChanged to true
+ */
+struct janus_Rect* janus_AddWorldRect(struct janus_PhysicsWorld* world, struct janus_Rect* rect);
+
+/**
+ * Steps every object in the world: applies velocity and gravity, resolves collisions against rects and other objects, then dampens velocity.
+ * Objects and rects are bucketed into a spatial hash first, so only objects sharing a cell are handed to the collision functions.
+ * Islands of touching objects that stay still fall asleep and are skipped until something wakes them; see world->awakeCount and world->sleepingCount.
+ *
+ * @param world world to step
+ * @param deltaMS milliseconds since the last step
+ *
+ * @note After this returns, world->onFloor[i] is true if object i is standing on a rect or on another object (good for jump logic)
+ */
+void janus_StepWorld(struct janus_PhysicsWorld* world, int24_t deltaMS);
+
+/**
+ * Adds a frame's delta time to a timestep and returns how many fixed steps to run for it (at most timestep->maxSteps).
+ * Afterwards timestep->alpha holds how far the frame is into the next step.
+ *
+ * @param timestep timestep to advance
+ * @param deltaMS milliseconds since the last frame, e.g. from janus_GetDeltaTime()
+ * @returns number of steps of timestep->stepMS milliseconds to run this frame; always 0 if stepMS isn't above 0
+ *
+ * @example for(steps = janus_AccumulateTimestep(&timestep,deltaMS); steps > 0; steps--) { ...update physics with timestep.stepMS... }
+ */
+uint8_t janus_AccumulateTimestep(struct janus_Timestep* timestep, int24_t deltaMS);
+
+/**
+ * Calls janus_StepWorld(...) as many times as janus_AccumulateTimestep(...) says to, always with timestep->stepMS
+ *
+ * @param world world to step
+ * @param timestep timestep driving the world
+ * @param deltaMS milliseconds since the last frame
+ */
+void janus_StepWorldTimestep(struct janus_PhysicsWorld* world, struct janus_Timestep* timestep, int24_t deltaMS);
+
+/**
+ * Blends an object's previous and current positions, so rendering stays smooth when physics runs at a lower rate than the screen
+ *
+ * @param object object to draw
+ * @param alpha How far (0 to 1000) between the previous and current position; usually timestep->alpha
+ * @returns position to draw the object at
+ */
+struct janus_Vector2 janus_GetInterpolatedPosition(struct janus_PhysicsObject* object, int24_t alpha);
+
+/**
+ * Wakes a sleeping world object along with every object in its island.
+ * Objects also wake on their own when something hits them or when their velocity is changed (e.g. with janus_AddForce) while asleep.
+ *
+ * @param world world holding the object
+ * @param index index of the object in world->objects
+ */
+void janus_WakeWorldObject(struct janus_PhysicsWorld* world, uint8_t index);
+
+/*****************/
+/* Physics Batch */
+/*****************/
+
+/**
+ * Copies a physics object into slot index of a batch
+ *
+ * @param batch batch to copy into
+ * @param index slot to overwrite; pass batch->count (and increase it) to add an object
+ * @param object object to copy
+ */
+void janus_SetBatchObject(struct janus_PhysicsBatch* batch, uint8_t index, struct janus_PhysicsObject* object);
+
+/**
+ * Copies slot index of a batch out into a physics object, e.g. to hand it to the collision functions
+ *
+ * @param batch batch to copy from
+ * @param index slot to copy
+ * @param object object to fill
+ */
+void janus_GetBatchObject(struct janus_PhysicsBatch* batch, uint8_t index, struct janus_PhysicsObject* object);
+
+/**
+ * Does janus_ApplyVelocity, janus_AddForce(gravity) and janus_DampenVelocity for every object of a batch in one loop, with the same results as calling them per object.
+ * Anchored objects are skipped.
+ *
+ * @param batch batch to step
+ * @param gravity velocity added to every object
+ * @param dampen same as janus_DampenVelocity's dampen; a zero component skips dampening on that axis
+ * @param deltaMS milliseconds since the last step
+ */
+void janus_StepPhysicsBatch(struct janus_PhysicsBatch* batch, struct janus_Vector2* gravity, struct janus_Vector2* dampen, int24_t deltaMS);
+
+/*******************/
+/* Sweep and Prune */
+/*******************/
+
+/**
+ * Sets up a sweep and prune over an array of physics objects
+ *
+ * @param sap sweep and prune to set up
+ * @param objects array of objects to sweep; the array is not copied
+ * @param objectCount number of objects in the array (Don't exceed JANUS_SAP_MAX_OBJECTS)
+ */
+void janus_InitSweepAndPrune(struct janus_SweepAndPrune* sap, struct janus_PhysicsObject* objects, uint8_t objectCount);
+
+/**
+ * Re-sorts the objects by their left edge and fills sap->pairs with every overlapping pair.
+ * The list is kept between calls and re-sorted with an insertion sort, which is nearly free when objects only move a few pixels a frame.
+ *
+ * @param sap sweep and prune to update
+ *
+ * @note sap->pairsTested and sap->pairsOverlapping show how many of the possible pairs were pruned
+ */
+void janus_UpdateSweepAndPrune(struct janus_SweepAndPrune* sap);
+
+/**
+ * Calls janus_HandleObjectObjectCollision(...) for every pair found by the last janus_UpdateSweepAndPrune(...)
+ *
+ * @param sap sweep and prune holding the pairs
+ * @param onFloor optional array (one bool per object) that gets set to true for objects that land on top of another object; may be NULL
+ */
+void janus_HandleSweepAndPruneCollisions(struct janus_SweepAndPrune* sap, bool* onFloor);
+
 /***************************/
 /* Debouncing & Delta Time */
 /***************************/
@@ -318,12 +1220,14 @@ void janus_UpdateDebouncedKeys(void);
 /** 
  * Converts milliseconds delta time into frames per second
  * @param msElapsed acquired by calling janus_GetDeltaTime at the start of each frame
- * @returns frame rate based on input delta time
+ * @returns frame rate based on input delta time; 1000 for frames shorter than a millisecond
+ * @note a single frame jitters a lot, so janus_GetFrameStats(...) gives a steadier number
 **/
 int24_t janus_GetFPS(int24_t msElapsed);
 
 /** 
  * Gives milliseconds since the last time the function was called.
+ * Measured with clock(), which counts on timer 1; JANUS_TIMER_NUMBER must stay off that timer for this to keep working alongside the frame clock or profiler.
  * 
  * @returns uint24_t containing the number of milliseconds since the function was last called.
  * 
@@ -332,6 +1236,220 @@ int24_t janus_GetFPS(int24_t msElapsed);
 int24_t janus_GetDeltaTime(void);
 
 
+/***************/
+/* Frame Clock */
+/***************/
+
+/**
+ * Sets up a frame clock and starts the JANUS_TIMER_NUMBER timer counting CPU cycles
+ * The timer mustn't be the one clock() uses (timer 1), or janus_GetDeltaTime(...) and recordings get corrupted delta times
+ * 
+ * @param clock clock to set up
+ * @param targetFPS frames per second janus_TickFrameClock(...) holds frames to; 0 for no limit
+**/
+void janus_InitFrameClock(struct janus_FrameClock* clock, uint8_t targetFPS);
+
+/**
+ * Changes the frame rate a clock holds frames to
+ * 
+ * @param clock clock to change
+ * @param targetFPS frames per second; 0 for no limit
+**/
+void janus_SetFrameLimit(struct janus_FrameClock* clock, uint8_t targetFPS);
+
+/**
+ * Ends a frame: waits until the target frame time is up if there is one, then measures how long the frame took
+ * Call once per frame, in place of janus_GetDeltaTime(...)
+ * The wait doesn't idle the CPU on the calculator: delay(...) and the final spin on the timer both keep it busy, so limiting saves no battery. The eZ80's HALT only wakes on an interrupt,
+ * and programs have no supported way to arm one without taking the OS's interrupt setup over. On a PC it sleeps, then spins for the last bit.
+ * 
+ * @param clock clock to tick
+ * @returns microseconds since the last tick; clock->deltaMS has the same time in whole milliseconds
+ * @note the frame clock doesn't take part in janus_StartRecording(...) or janus_StartReplay(...)
+**/
+uint24_t janus_TickFrameClock(struct janus_FrameClock* clock);
+
+/**
+ * Works out average, 95th and 99th percentile and worst frame times over the clock's window
+ * Sorts a copy of the window, so call it when showing stats rather than every frame
+ * 
+ * @param clock clock to read
+ * @param stats where to write the results, in microseconds
+**/
+void janus_GetFrameStats(const struct janus_FrameClock* clock, struct janus_FrameStats* stats);
+
+
+#if JANUS_PROFILER
+/************/
+/* Profiler */
+/************/
+
+/**
+ * Clears the profiler and starts the JANUS_TIMER_NUMBER timer counting CPU cycles; call before profiling
+ * The timer mustn't be the one clock() uses (timer 1), or janus_GetDeltaTime(...) and recordings get corrupted delta times
+**/
+void janus_InitProfiler(void);
+
+/**
+ * Names a profiler zone so it shows up in the overlay and CSV
+ * 
+ * @param zone 0 to JANUS_PROFILER_MAX_ZONES - 1
+ * @param name name to show; must stay valid while profiling
+**/
+void janus_NameProfilerZone(uint8_t zone, const char* name);
+
+/**
+ * Starts timing a zone; use JANUS_PROFILE_BEGIN(...) instead so it can be compiled out
+ * 
+ * @param zone 0 to JANUS_PROFILER_MAX_ZONES - 1
+**/
+void janus_BeginProfilerZone(uint8_t zone);
+
+/**
+ * Stops timing a zone and adds the time to this frame's total; use JANUS_PROFILE_END(...) instead so it can be compiled out
+ * 
+ * @param zone 0 to JANUS_PROFILER_MAX_ZONES - 1
+**/
+void janus_EndProfilerZone(uint8_t zone);
+
+/**
+ * Moves this frame's zone totals into the history ring buffer; call once at the end of every frame
+**/
+void janus_EndProfilerFrame(void);
+
+/**
+ * Works out the min/avg/max time per frame a zone took over the profiler's history
+ * 
+ * @param zone 0 to JANUS_PROFILER_MAX_ZONES - 1
+ * @param stats where to write the results, in microseconds
+**/
+void janus_GetProfilerStats(uint8_t zone, struct janus_ProfilerStats* stats);
+
+/**
+ * Draws each named zone's average and worst time per frame (in microseconds) in a small box
+ * 
+ * @param x left of the box
+ * @param y top of the box
+ * @param backgroundColor box color
+ * @param foregroundColor text and outline color
+**/
+void janus_RenderProfiler(uint24_t x, uint8_t y, uint8_t backgroundColor, uint8_t foregroundColor);
+
+#ifndef __TICE__
+/**
+ * Writes the profiler history as CSV: one row per frame, oldest first, and one column of microseconds per named zone
+ * Only available when building for a PC
+ * 
+ * @param file file to write to, e.g. stdout
+**/
+void janus_DumpProfilerCSV(FILE* file);
+#endif
+#endif
+
+
+/*******************/
+/* Input Recording */
+/*******************/
+
+/**
+ * Starts recording every frame's kb_Data and delta time
+ * Each janus_GetDeltaTime(...) call starts a frame. The keys recorded for it are kb_Data as it was the first time janus_GetKeyGroup(...),
+ * janus_UpdateDebouncedKeys(...), janus_PollInput(...) or janus_RenderQuickUI(...) read it that frame, and every later read that frame sees the same keys.
+ * Read keys only through those, not kb_Data, for a replay to match the recorded run.
+ * 
+ * @param recording recording to fill
+ * @param buffer where to write the encoded frames
+ * @param capacity size of buffer in bytes
+**/
+void janus_StartRecording(struct janus_InputRecording* recording, uint8_t* buffer, uint24_t capacity);
+
+/**
+ * Stops recording and writes out the frame in progress and any frames still waiting
+ * 
+ * @param recording recording to finish
+ * @returns bytes of buffer used; save that many to replay later
+**/
+uint24_t janus_StopRecording(struct janus_InputRecording* recording);
+
+/**
+ * Plays back a recording: janus_GetDeltaTime(...) returns the recorded delta times, and janus_UpdateDebouncedKeys(...), janus_PollInput(...) and janus_GetKeyGroup(...) see the recorded keys
+ * The debounced keys go back to how they were when recording started, so the first frame's janus_PressedKeys match; janus_InputQueues aren't touched, so set those up the same way as before recording
+ * Replaying needs no timer or keypad, so a game loop can be run headless on a PC with stand-ins for the toolchain headers
+ * 
+ * @param recording recording to play back into
+ * @param data encoded frames from an earlier recording
+ * @param size bytes of data
+**/
+void janus_StartReplay(struct janus_InputRecording* recording, const uint8_t* data, uint24_t size);
+
+/**
+ * Stops a replay early and goes back to the real keypad and timer
+ * 
+ * @param recording recording being replayed
+**/
+void janus_StopReplay(struct janus_InputRecording* recording);
+
+/**
+ * Reads one kb_Data group, or its recorded value during a replay; read keys through this for replays to reproduce them
+ * 
+ * @param group kb_Data index
+ * @returns the group's key bits
+**/
+uint8_t janus_GetKeyGroup(uint8_t group);
+
+/**
+ * Adds bytes to a running 24-bit FNV-1a hash; hash game state every frame to check two runs match frame by frame
+ * 
+ * @param hash hash so far; start with JANUS_HASH_START
+ * @param data bytes to add
+ * @param size number of bytes
+ * @returns updated hash
+**/
+uint24_t janus_HashBytes(uint24_t hash, const void* data, uint24_t size);
+
+
+/****************/
+/* Input Events */
+/****************/
+
+/**
+ * Empties an input queue and turns auto-repeat off for every group; call before using it
+ * 
+ * @param queue queue to set up
+**/
+void janus_InitInputQueue(struct janus_InputQueue* queue);
+
+/**
+ * Sets up auto-repeat for one kb_Data group; the most recently pressed key in the group repeats while held
+ * 
+ * @param queue queue to set up
+ * @param group kb_Data index, e.g. 7 for the arrow keys
+ * @param delayMS how long a key has to be held before it first repeats
+ * @param rateMS time between repeats after that; 0 turns repeating off
+**/
+void janus_SetKeyRepeat(struct janus_InputQueue* queue, uint8_t group, uint24_t delayMS, uint24_t rateMS);
+
+/**
+ * Adds events for every key that went down or up since the last poll, plus any repeats that are due
+ * Polling more than once a frame catches presses shorter than a frame
+ * 
+ * @param queue queue to add events to
+ * @param nowMS clock time in milliseconds, stamped on the events
+ * @note make sure kb_Scan is called before calling this function
+**/
+void janus_PollInput(struct janus_InputQueue* queue, uint24_t nowMS);
+
+/**
+ * Takes the oldest event off an input queue
+ * 
+ * @param queue queue to take from
+ * @param event where to copy the event
+ * @returns false if the queue is empty
+ * @example while(janus_PopInputEvent(&input,&event)) { if(event.group == 7 && event.key == kb_Up && event.type != JANUS_INPUT_UP) { ... } }
+**/
+bool janus_PopInputEvent(struct janus_InputQueue* queue, struct janus_InputEvent* event);
+
+
 /************************/
 /* Easing and Animation */
 /************************/
@@ -345,14 +1463,109 @@ int24_t janus_GetDeltaTime(void);
 void janus_UpdateEase(struct janus_Ease* ease, int24_t msElapsed);
 
 /**
- * Returns the progress of an easing mode based on alpha (0-1).
+ * Returns the progress of an easing mode based on alpha (0-1000), read from a table instead of calculated
  * 
  * @param easingMode Takes a janus_EasingMode to determine what way to interpolate
- * @param alpha Takes a float between 0 (0%) and 1 (100%)
+ * @param alpha Takes an integer between 0 (0%) and 1000 (100%)
+ * 
+ * @returns progress of ease from 0 to 1000; BACK and ELASTIC modes go a little past either end
+**/
+int24_t janus_GetEaseProgress(enum janus_EasingMode easingMode, uint24_t alpha);
+
+/**
+ * Sets up a janus_TimedEase; nothing needs to be updated afterwards
+ * 
+ * @param ease ease to set up
+ * @param from start of ease
+ * @param to end of ease
+ * @param startTime clock time, in milliseconds, that the ease starts at
+ * @param length how long the ease should be in milliseconds
+ * @param easingMode how to interpolate between from and to
+**/
+void janus_InitTimedEase(struct janus_TimedEase* ease, struct janus_Vector2* from, struct janus_Vector2* to, uint24_t startTime, int24_t length, enum janus_EasingMode easingMode);
+
+/**
+ * Works out where a janus_TimedEase is at a given time; only call it for things that are actually drawn
+ * 
+ * @param ease ease to sample
+ * @param nowMS clock time in milliseconds, from the same clock as startTime; any time works, so seeking is just a different nowMS
+ * @returns from before the ease starts, to after it ends, and the eased position in between
+ * @note The clock may wrap around; times are compared as differences, which work within 2 hours of startTime
+**/
+struct janus_Vector2 janus_EaseSampleAt(struct janus_TimedEase* ease, uint24_t nowMS);
+
+/**
+ * Checks whether a janus_TimedEase has reached its end
+ * 
+ * @param ease ease to check
+ * @param nowMS clock time in milliseconds
+ * @returns true once nowMS is at least length past startTime
+**/
+bool janus_IsEaseFinishedAt(struct janus_TimedEase* ease, uint24_t nowMS);
+
+/**
+ * Empties a tween pool; call before using it
+ * 
+ * @param pool tween pool to set up
+**/
+void janus_InitTweens(struct janus_TweenPool* pool);
+
+/**
+ * Starts tweening an int24_t from one value to another
+ * 
+ * @param pool tween pool to add the tween to
+ * @param target value to animate; must stay valid until the tween finishes or is cancelled
+ * @param from start value
+ * @param to end value
+ * @param length how long the tween lasts in milliseconds
+ * @param easingMode how to interpolate between from and to
+ * @returns handle of the tween, or JANUS_TWEEN_NONE if the pool is full
+ * @note Handles are reused once a tween finishes, so don't hold onto them past that
+**/
+uint8_t janus_StartTween(struct janus_TweenPool* pool, int24_t* target, int24_t from, int24_t to, int24_t length, enum janus_EasingMode easingMode);
+
+/**
+ * Adds a tween that starts once another tween (and anything already chained after it) finishes
+ * 
+ * @param pool tween pool the tweens are in
+ * @param after handle of the tween to follow
+ * @returns handle of the new tween, or JANUS_TWEEN_NONE if the pool is full or after isn't live
+ * @note Other parameters are the same as janus_StartTween(...); tweens chained after a yoyo tween never start
+**/
+uint8_t janus_ChainTween(struct janus_TweenPool* pool, uint8_t after, int24_t* target, int24_t from, int24_t to, int24_t length, enum janus_EasingMode easingMode);
+
+/**
+ * Makes a tween play back and forth between its start and end until it is cancelled
+ * 
+ * @param pool tween pool the tween is in
+ * @param handle handle of the tween
+**/
+void janus_YoyoTween(struct janus_TweenPool* pool, uint8_t handle);
+
+/**
+ * Stops a tween where it is, along with every tween chained after it
  * 
- * @returns float containing progress of ease
+ * @param pool tween pool the tween is in
+ * @param handle handle of the tween
 **/
-uint24_t janus_GetEaseProgress(enum janus_EasingMode easingMode, uint24_t alpha);
+void janus_CancelTween(struct janus_TweenPool* pool, uint8_t handle);
+
+/**
+ * Checks whether a handle still belongs to a running or waiting tween
+ * 
+ * @param pool tween pool the tween is in
+ * @param handle handle of the tween
+ * @returns true if the tween hasn't finished or been cancelled
+**/
+bool janus_IsTweenLive(struct janus_TweenPool* pool, uint8_t handle);
+
+/**
+ * Advances every live tween in a pool and writes their targets, removing the ones that finish
+ * 
+ * @param pool tween pool to update
+ * @param msElapsed The time (in milliseconds) to add to each tween's progress
+**/
+void janus_UpdateTweens(struct janus_TweenPool* pool, int24_t msElapsed);
 
 /**
  * Updates an animation by setting the current frame/elapsed time.
@@ -371,6 +1584,146 @@ void janus_UpdateAnimation(struct janus_Animation* animation, int24_t msElapsed)
 **/ 
 gfx_sprite_t* janus_GetAnimationFrame(struct janus_Animation* animation);
 
+/**
+ * Starts a player at the beginning of a clip at normal speed
+ * 
+ * @param player player to set up
+ * @param clip clip to play; many players can share one clip
+ * @example static gfx_sprite_t* const walkFrames[] = {walk1,walk2,walk3,walk4}; static const struct janus_AnimationClip walk = {walkFrames,NULL,100,4,true};
+**/
+void janus_InitAnimationPlayer(struct janus_AnimationPlayer* player, const struct janus_AnimationClip* clip);
+
+/**
+ * Updates an animation player by setting the current frame/elapsed time; like janus_UpdateAnimation(...) but scaled by the player's speed
+ * 
+ * @param player Pointer to player to update
+ * @param msElapsed Time since last call to update the player
+**/
+void janus_UpdateAnimationPlayer(struct janus_AnimationPlayer* player, int24_t msElapsed);
+
+/**
+ * Returns a pointer to the current frame of an animation player
+ * 
+ * @param player
+ * 
+ * @returns pointer to gfx_sprite_t
+ * @note For clips using compressedFrames, the frame lives in the clip's cache and may be replaced by later lookups, so draw it before getting more frames than the cache has slots.
+ * Compressed frames must come from janus_CompressSprite(...), which refuses frames too big for the cache, so the result is never NULL
+**/
+gfx_sprite_t* janus_GetAnimationPlayerFrame(struct janus_AnimationPlayer* player);
+
+
+/**********************/
+/* Compressed Sprites */
+/**********************/
+
+/**
+ * Run-length encodes a sprite; meant for preparing data ahead of time, e.g. in a host-side tool
+ * The output is the width and height bytes followed by runs: a byte n < 128 means n + 1 literal bytes follow, and n >= 128 means the next byte repeats n - 127 times
+ * 
+ * @param sprite sprite to compress
+ * @param output where to write the compressed frame
+ * @param maxSize size of output in bytes
+ * @returns bytes written to output, or 0 if it didn't fit or the sprite has more than JANUS_FRAME_CACHE_MAX_PIXELS pixels (too big for a janus_FrameCache slot)
+**/
+uint24_t janus_CompressSprite(const gfx_sprite_t* sprite, uint8_t* output, uint24_t maxSize);
+
+/**
+ * Decompresses a frame made by janus_CompressSprite(...)
+ * 
+ * @param compressed compressed frame
+ * @param sprite where to write the sprite; must have room for width * height pixels
+ * @returns sprite
+**/
+gfx_sprite_t* janus_DecompressSprite(const uint8_t* compressed, gfx_sprite_t* sprite);
+
+/**
+ * Empties a transform cache; call before using it
+ * 
+ * @param cache cache to set up
+**/
+void janus_InitTransformCache(struct janus_TransformCache* cache);
+
+/**
+ * Returns a scaled, mirrored or rotated copy of a sprite, only making it if it isn't already in the cache
+ * Scaling happens first, then JANUS_TRANSFORM_MIRROR, JANUS_TRANSFORM_FLIP, and the rotations in the order they are listed
+ * 
+ * @param cache cache to look in
+ * @param sprite sprite to transform
+ * @param transform JANUS_TRANSFORM_ flags ORed together, or 0
+ * @param scale whole number scale, 1 for none; the scaled sprite must be at most 255 pixels wide and tall
+ * @returns transformed sprite, ready to draw with plain sprite functions; valid until a later lookup misses. NULL if it can't fit in the cache,
+ * which takes 2 + width * height bytes times the scale squared, twice over while making it if more than one of scaling and the transforms is applied
+ * @example gfx_TransparentSprite(janus_GetTransformedSprite(&cache,frame,facingLeft ? JANUS_TRANSFORM_MIRROR : 0,4),x,y);
+**/
+gfx_sprite_t* janus_GetTransformedSprite(struct janus_TransformCache* cache, const gfx_sprite_t* sprite, uint8_t transform, uint8_t scale);
+
+/**
+ * Returns the current frame of an animation player transformed through a janus_TransformCache
+ * Compressed frames are only decompressed when their transformed copy isn't cached
+ * 
+ * @param player
+ * @param cache cache to look in
+ * @param transform JANUS_TRANSFORM_ flags ORed together, or 0
+ * @param scale whole number scale, 1 for none
+ * @returns transformed frame; see janus_GetTransformedSprite(...)
+**/
+gfx_sprite_t* janus_GetTransformedAnimationPlayerFrame(struct janus_AnimationPlayer* player, struct janus_TransformCache* cache, uint8_t transform, uint8_t scale);
+
+/**
+ * Empties a frame cache; call before using it
+ * 
+ * @param cache cache to set up
+**/
+void janus_InitFrameCache(struct janus_FrameCache* cache);
+
+/**
+ * Returns a compressed frame decompressed, only decompressing it if it isn't already in the cache
+ * 
+ * @param cache cache to look in
+ * @param compressed compressed frame made by janus_CompressSprite(...)
+ * @returns pointer to the decompressed sprite, valid until JANUS_FRAME_CACHE_SLOTS other frames have been looked up
+ * @note never NULL for frames made by janus_CompressSprite(...); hand-made data with more than JANUS_FRAME_CACHE_MAX_PIXELS pixels gives NULL and isn't counted in uses, hits or misses
+**/
+gfx_sprite_t* janus_GetCachedFrame(struct janus_FrameCache* cache, const uint8_t* compressed);
+
+
+
+/*********/
+/* Paths */
+/*********/
+
+/**
+ * Flattens control points into a janus_Path; the curve math all happens here, once
+ * 
+ * @param path path to build
+ * @param type POLYLINE, CATMULL_ROM, or BEZIER
+ * @param points control points; coordinates should stay within -16383 to 16383
+ * @param pointCount number of control points; at least 2, and 3n+1 for BEZIER
+ * @returns false if pointCount doesn't suit type; the path is left empty
+ * @note Samples are shared evenly between segments, so more points means fewer samples per segment
+**/
+bool janus_BuildPath(struct janus_Path* path, enum janus_PathType type, struct janus_Vector2* points, uint8_t pointCount);
+
+/**
+ * Finds the point a given distance along a path
+ * 
+ * @param path path built with janus_BuildPath(...)
+ * @param distance pixels from the start of the path; clamped to the path's length
+ * @returns position on the path
+**/
+struct janus_Vector2 janus_SamplePath(struct janus_Path* path, int24_t distance);
+
+/**
+ * Finds the point on a path for an ease's alpha, so an easing mode sets the pace along the path
+ * 
+ * @param path path built with janus_BuildPath(...)
+ * @param easingMode how to pace movement along the path
+ * @param alpha how far (0 to 1000) along the path in time
+ * @returns position on the path; BACK and ELASTIC modes stop at either end instead of overshooting
+ * @note Paths should be shorter than 8000 pixels
+**/
+struct janus_Vector2 janus_SamplePathEased(struct janus_Path* path, enum janus_EasingMode easingMode, uint24_t alpha);
 
 
 /*************/
@@ -387,6 +1740,25 @@ gfx_sprite_t* janus_GetAnimationFrame(struct janus_Animation* animation);
 **/
 bool janus_UpdateQuickUI(struct janus_QuickUI* ui);
 
+/**
+ * Updates a UI's cursor and selection from one input event, so held arrow keys auto-repeat through the options
+ * 
+ * @param ui A pointer to a janus_QuickUI to update
+ * @param event event taken from a janus_InputQueue with janus_PopInputEvent(...)
+ * @returns true if the event selected an option (use cursorPosition to find which one)
+ * @example janus_SetKeyRepeat(&input,7,400,100); ... while(janus_PopInputEvent(&input,&event)) { if(janus_HandleQuickUIEvent(&ui,&event)) { ... } }
+**/
+bool janus_HandleQuickUIEvent(struct janus_QuickUI* ui, struct janus_InputEvent* event);
+
+/**
+ * Gets where an option's button is drawn (when not hovered), measuring the layout first if it has changed
+ * 
+ * @param ui A pointer to a janus_QuickUI
+ * @param option index of the option, less than numberOfOptions
+ * @param rect where to write the button's position and size
+**/
+void janus_GetQuickUIButtonRect(struct janus_QuickUI* ui, uint8_t option, struct janus_Rect* rect);
+
 
 /**
  * Renders a QuickUI
@@ -394,6 +1766,7 @@ bool janus_UpdateQuickUI(struct janus_QuickUI* ui);
  * @param ui A pointer to a janus_QuickUI to render
  * 
  * @warning unclipped; be careful with non-zero UI offsets or really long option texts
+ * @note option widths are only measured when the layout changes; set layoutCached to false after editing option text in place
 **/
 void janus_RenderQuickUI(struct janus_QuickUI* ui);
 
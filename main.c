@@ -100,8 +100,9 @@ int main(void)
     gfx_SetTransparentColor(0);
 
     while(!(kb_Data[6] & kb_Clear)) {
-        int24_t deltaMS = janus_GetDeltaTime();
+        int24_t deltaMS;
         kb_Scan();
+        deltaMS = janus_GetDeltaTime();
         //janus_UpdateDebouncedKeys can be called every frame just after kb_Scan is
         janus_UpdateDebouncedKeys();
 
@@ -190,15 +191,15 @@ void update(struct Demo* demo, int24_t deltaMS) {
             ableToJump = true;
         
         // Left/Right Movement for Object 1, the player 
-        if(kb_Data[7] & kb_Right) {
+        if(janus_GetKeyGroup(7) & kb_Right) {
             janus_AddForce(&demo->object1,&(struct janus_Vector2){PLAYER_SPEED,0});
         }
-        if(kb_Data[7] & kb_Left) {
+        if(janus_GetKeyGroup(7) & kb_Left) {
             janus_AddForce(&demo->object1,&(struct janus_Vector2){-PLAYER_SPEED,0});
         }
 
         // Jumping for Object 1, the player
-        if(kb_Data[7] & kb_Up && ableToJump) {
+        if(janus_GetKeyGroup(7) & kb_Up && ableToJump) {
             janus_AddForce(&demo->object1,&(struct janus_Vector2){0,PLAYER_JUMP});
         }
 
@@ -263,7 +264,8 @@ void render(struct Demo* demo, int24_t deltaMS) {
 
 void renderFps(int24_t deltaMS) {
     char* text = "FPS: 00";
-    sprintf(text,"FPS: %d",janus_Min(99,1000/deltaMS));
+    /* janus_GetFPS(...) copes with frames too short to measure */
+    sprintf(text,"FPS: %d",janus_Min(99,janus_GetFPS(deltaMS)));
     gfx_SetTextFGColor(0xEF);
     gfx_PrintStringXY(text,270,10);
 }
@@ -0,0 +1,61 @@
+/*
+ * Compares janus_GetEaseProgress(...) table lookups with evaluating each easing curve directly, and reports how far the tables stray
+ */
+#include "host.h"
+#include "easing_curves.h"
+
+#define MODES (BOUNCE_IN_OUT + 1)
+#define ROUNDS 2000
+
+static const char* const kindNames[3] = {"IN","OUT","IN_OUT"};
+
+/* Direct evaluation, kept out of line like a library call would be */
+__attribute__((noinline)) static int24_t evaluateEase(int mode, uint24_t alpha) {
+    return (int24_t)lround(1000 * easeMode(mode,alpha / 1000.0));
+}
+
+int main(void) {
+    int mode;
+    uint24_t alpha, round;
+    double start, tableTime, directTime, worstError;
+    long sum = 0;
+
+    printf("%-18s %10s %10s %12s\n","mode","table ns","direct ns","worst error");
+    for(mode = 0; mode < MODES; mode++) {
+        char name[24];
+        worstError = 0;
+        for(alpha = 0; alpha <= JANUS_ONE_SECOND; alpha++) {
+            double error = fabs(janus_GetEaseProgress(mode,alpha) - 1000 * easeMode(mode,alpha / 1000.0));
+            if(error > worstError) {
+                worstError = error;
+            }
+        }
+        /* Elastic's wobbles and bounce's sharp corners fall between the 64 table entries; the smooth curves stay within rounding */
+        CHECK(worstError <= (mode >= ELASTIC_IN ? 25 : 2));
+
+        start = janus_TestSeconds();
+        for(round = 0; round < ROUNDS; round++) {
+            for(alpha = 0; alpha <= JANUS_ONE_SECOND; alpha++) {
+                sum += janus_GetEaseProgress(mode,alpha);
+            }
+        }
+        tableTime = janus_TestSeconds() - start;
+        start = janus_TestSeconds();
+        for(round = 0; round < ROUNDS; round++) {
+            for(alpha = 0; alpha <= JANUS_ONE_SECOND; alpha++) {
+                sum += evaluateEase(mode,alpha);
+            }
+        }
+        directTime = janus_TestSeconds() - start;
+
+        if(mode == LINEAR) {
+            snprintf(name,sizeof(name),"LINEAR");
+        } else {
+            snprintf(name,sizeof(name),"%s_%s",easeFamilyNames[(mode - 1) / 3],kindNames[(mode - 1) % 3]);
+        }
+        printf("%-18s %10.1f %10.1f %12.1f\n",name,tableTime / ROUNDS / 1001 * 1e9,directTime / ROUNDS / 1001 * 1e9,worstError);
+    }
+    KEEP(sum);
+    printf("Times are per call on this PC; the calculator has no FPU, so direct evaluation costs far more there\n");
+    return TEST_RESULT("bench_easing");
+}
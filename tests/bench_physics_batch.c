@@ -0,0 +1,72 @@
+/*
+ * Checks janus_StepPhysicsBatch(...) against the per-object physics calls, then times both
+ */
+#include "host.h"
+
+#define OBJECTS 64
+#define FRAMES 200000
+
+static void randomObjects(struct janus_PhysicsBatch* batch, struct janus_PhysicsObject* objects) {
+    uint8_t i;
+    batch->count = OBJECTS;
+    for(i = 0; i < OBJECTS; i++) {
+        memset(&objects[i],0,sizeof(struct janus_PhysicsObject));
+        objects[i].rect.position = (struct janus_Vector2){rand() % 300,rand() % 200};
+        objects[i].rect.size = (struct janus_Vector2){10,10};
+        objects[i].velocity = (struct janus_Vector2){rand() % 400 - 200,rand() % 400 - 200};
+        objects[i].resistance = 1;
+        objects[i].anchored = rand() % 8 == 0;
+        janus_SetBatchObject(batch,i,&objects[i]);
+    }
+}
+
+static void stepObjects(struct janus_PhysicsObject* objects, struct janus_Vector2* gravity, struct janus_Vector2* keep, int24_t deltaMS) {
+    uint8_t i;
+    for(i = 0; i < OBJECTS; i++) {
+        if(!objects[i].anchored) {
+            janus_ApplyVelocity(&objects[i],deltaMS);
+            janus_AddForce(&objects[i],gravity);
+            janus_DampenVelocity(&objects[i],keep);
+        }
+    }
+}
+
+int main(void) {
+    static struct janus_PhysicsBatch batch;
+    static struct janus_PhysicsObject objects[OBJECTS];
+    struct janus_PhysicsObject fromBatch;
+    struct janus_Vector2 gravity = {0,7}, keep = {3,32};
+    volatile int24_t deltaMS = 16;
+    double start, batchTime, objectTime;
+    uint24_t frame;
+    uint8_t i;
+
+    srand(5);
+    randomObjects(&batch,objects);
+    for(frame = 0; frame < 100; frame++) {
+        janus_StepPhysicsBatch(&batch,&gravity,&keep,16 + frame % 5);
+        stepObjects(objects,&gravity,&keep,16 + frame % 5);
+        for(i = 0; i < OBJECTS; i++) {
+            janus_GetBatchObject(&batch,i,&fromBatch);
+            CHECK(fromBatch.rect.position.x == objects[i].rect.position.x && fromBatch.rect.position.y == objects[i].rect.position.y);
+            CHECK(fromBatch.velocity.x == objects[i].velocity.x && fromBatch.velocity.y == objects[i].velocity.y);
+        }
+    }
+
+    randomObjects(&batch,objects);
+    start = janus_TestSeconds();
+    for(frame = 0; frame < FRAMES; frame++) {
+        janus_StepPhysicsBatch(&batch,&gravity,&keep,deltaMS);
+        KEEP(batch.x[0]);
+    }
+    batchTime = janus_TestSeconds() - start;
+    start = janus_TestSeconds();
+    for(frame = 0; frame < FRAMES; frame++) {
+        stepObjects(objects,&gravity,&keep,deltaMS);
+        KEEP(objects[0].rect.position.x);
+    }
+    objectTime = janus_TestSeconds() - start;
+
+    printf("physics batch: %.1f ns/object batched, %.1f ns/object per-object calls\n",batchTime / FRAMES / OBJECTS * 1e9,objectTime / FRAMES / OBJECTS * 1e9);
+    return TEST_RESULT("bench_physics_batch");
+}
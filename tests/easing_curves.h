@@ -0,0 +1,69 @@
+/*
+ * Reference easing curves in floating point (https://easings.net/), shared by gen_tables.c and bench_easing.c
+ * Families are numbered in janus_EasingMode order: quad, cubic, sine, back, elastic, bounce
+ */
+#ifndef JANUS_EASING_CURVES_H
+#define JANUS_EASING_CURVES_H
+
+#include <math.h>
+
+#define EASE_FAMILIES 6
+#define EASE_PI 3.14159265358979323846
+#define EASE_BACK_C1 1.70158
+#define EASE_BACK_C3 (EASE_BACK_C1 + 1)
+#define EASE_ELASTIC_C4 (2 * EASE_PI / 3)
+
+static const char* const easeFamilyNames[EASE_FAMILIES] = {"Quad","Cubic","Sine","Back","Elastic","Bounce"};
+
+static double easeBounceOut(double x) {
+    const double n1 = 7.5625, d1 = 2.75;
+    if(x < 1 / d1) {
+        return n1 * x * x;
+    }
+    if(x < 2 / d1) {
+        x -= 1.5 / d1;
+        return n1 * x * x + 0.75;
+    }
+    if(x < 2.5 / d1) {
+        x -= 2.25 / d1;
+        return n1 * x * x + 0.9375;
+    }
+    x -= 2.625 / d1;
+    return n1 * x * x + 0.984375;
+}
+
+/* A family's ease-in curve for x from 0 to 1 */
+static double easeIn(int family, double x) {
+    switch(family) {
+        case 0:
+            return x * x;
+        case 1:
+            return pow(x,3);
+        case 2:
+            return 1 - cos(EASE_PI * x / 2);
+        case 3:
+            return EASE_BACK_C3 * pow(x,3) - EASE_BACK_C1 * x * x;
+        case 4:
+            return x == 0 ? 0 : x == 1 ? 1 : -pow(2,10 * x - 10) * sin((10 * x - 10.75) * EASE_ELASTIC_C4);
+        default:
+            return 1 - easeBounceOut(1 - x);
+    }
+}
+
+/* Any janus_EasingMode's curve, from its family's ease-in curve the same way janus_GetEaseProgress(...) mirrors it */
+static double easeMode(int mode, double x) {
+    int family = (mode - 1) / 3;
+    if(mode == 0) {
+        return x;
+    }
+    switch((mode - 1) % 3) {
+        case 0:
+            return easeIn(family,x);
+        case 1:
+            return 1 - easeIn(family,1 - x);
+        default:
+            return x <= 0.5 ? easeIn(family,x * 2) / 2 : 1 - easeIn(family,2 - x * 2) / 2;
+    }
+}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * Generates janus's lookup tables from libm.
+ *
+ * gen_tables              prints every table as C, ready to paste into janus.c
+ * gen_tables --check FILE exits non-zero unless every generated table appears in FILE exactly
+ *
+ * The CE toolchain builds janus.c as-is, so the tables are checked in; `make -C tests test` runs --check so they can't drift.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "easing_curves.h"
+
+#define PI 3.14159265358979323846
+#define TABLE_TEXT_SIZE 4096
+#define PER_LINE 16
+
+struct table {
+    const char* name;
+    char text[TABLE_TEXT_SIZE];
+};
+
+/* Formats values as janus.c does: four-space indent, PER_LINE values a line, no trailing comma */
+static void formatTable(struct table* table, const char* name, const long* values, int count) {
+    int i, length = 0;
+    table->name = name;
+    for(i = 0; i < count; i++) {
+        if(i % PER_LINE == 0) {
+            length += snprintf(table->text + length,TABLE_TEXT_SIZE - length,"    ");
+        }
+        length += snprintf(table->text + length,TABLE_TEXT_SIZE - length,"%ld",values[i]);
+        if(i + 1 < count) {
+            length += snprintf(table->text + length,TABLE_TEXT_SIZE - length,(i % PER_LINE == PER_LINE - 1) ? ",\n" : ", ");
+        }
+    }
+}
+
+/* round(256 * sin(i * 2pi / 256)) for i from 0 to 64 */
+static void sinTable(struct table* table) {
+    long values[65];
+    int i;
+    for(i = 0; i <= 64; i++) {
+        values[i] = lround(256 * sin(i * 2 * PI / 256));
+    }
+    formatTable(table,"janus_SinTable",values,65);
+}
+
+/* round(atan(i / 64) * 256 / 2pi) for i from 0 to 64 */
+static void atanTable(struct table* table) {
+    long values[65];
+    int i;
+    for(i = 0; i <= 64; i++) {
+        values[i] = lround(atan(i / 64.0) * 256 / (2 * PI));
+    }
+    formatTable(table,"janus_AtanTable",values,65);
+}
+
+/* rint(1000 * in(i / 64)) for each easing family's ease-in curve, rounding halves to even */
+static void easeTable(struct table* table, int family) {
+    static char names[EASE_FAMILIES][32];
+    long values[65];
+    int i;
+    for(i = 0; i <= 64; i++) {
+        values[i] = (long)rint(1000 * easeIn(family,i / 64.0));
+    }
+    snprintf(names[family],sizeof(names[family]),"janus_Ease%sTable",easeFamilyNames[family]);
+    formatTable(table,names[family],values,65);
+}
+static void easeQuadTable(struct table* table) { easeTable(table,0); }
+static void easeCubicTable(struct table* table) { easeTable(table,1); }
+static void easeSineTable(struct table* table) { easeTable(table,2); }
+static void easeBackTable(struct table* table) { easeTable(table,3); }
+static void easeElasticTable(struct table* table) { easeTable(table,4); }
+static void easeBounceTable(struct table* table) { easeTable(table,5); }
+
+static void (*const generators[])(struct table*) = {
+    sinTable,
+    atanTable,
+    easeQuadTable,
+    easeCubicTable,
+    easeSineTable,
+    easeBackTable,
+    easeElasticTable,
+    easeBounceTable
+};
+#define TABLE_COUNT (sizeof(generators) / sizeof(generators[0]))
+
+/* Reads a whole file with any carriage returns dropped */
+static char* readSource(const char* path) {
+    FILE* file = fopen(path,"rb");
+    char* text;
+    long size, i, j;
+    if(file == NULL) {
+        return NULL;
+    }
+    fseek(file,0,SEEK_END);
+    size = ftell(file);
+    fseek(file,0,SEEK_SET);
+    text = malloc(size + 1);
+    if(text == NULL || fread(text,1,size,file) != (size_t)size) {
+        fclose(file);
+        free(text);
+        return NULL;
+    }
+    fclose(file);
+    for(i = j = 0; i < size; i++) {
+        if(text[i] != '\r') {
+            text[j++] = text[i];
+        }
+    }
+    text[j] = '\0';
+    return text;
+}
+
+int main(int argc, char** argv) {
+    static struct table tables[TABLE_COUNT];
+    size_t i;
+    int failures = 0;
+
+    for(i = 0; i < TABLE_COUNT; i++) {
+        generators[i](&tables[i]);
+    }
+    if(argc == 3 && strcmp(argv[1],"--check") == 0) {
+        char* source = readSource(argv[2]);
+        if(source == NULL) {
+            fprintf(stderr,"gen_tables: can't read %s\n",argv[2]);
+            return 1;
+        }
+        for(i = 0; i < TABLE_COUNT; i++) {
+            if(strstr(source,tables[i].text) == NULL) {
+                fprintf(stderr,"gen_tables: %s in %s doesn't match the generated table; regenerate it with gen_tables\n",tables[i].name,argv[2]);
+                failures++;
+            }
+        }
+        free(source);
+        printf("gen_tables --check: %s\n",failures ? "FAILED" : "ok");
+        return failures ? 1 : 0;
+    }
+    for(i = 0; i < TABLE_COUNT; i++) {
+        printf("/* %s */\n%s\n\n",tables[i].name,tables[i].text);
+    }
+    return 0;
+}
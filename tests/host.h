@@ -0,0 +1,39 @@
+/*
+ * Shared includes and helpers for the host tests and benchmarks
+ */
+#ifndef JANUS_HOST_TEST_H
+#define JANUS_HOST_TEST_H
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <tice.h>
+#include <graphx.h>
+#include <keypadc.h>
+#include <time.h>
+
+#include "janus.h"
+
+static int janus_TestFailures = 0;
+
+/* Records a failure with its location and keeps going so one run reports everything */
+#define CHECK(condition) do { \
+    if(!(condition)) { \
+        fprintf(stderr,"%s:%d: check failed: %s\n",__FILE__,__LINE__,#condition); \
+        janus_TestFailures++; \
+    } \
+} while(0)
+
+/* Exit status for main(): prints a summary line and fails if any CHECK(...) did */
+#define TEST_RESULT(name) (printf("%s: %s\n",name,janus_TestFailures ? "FAILED" : "ok"), janus_TestFailures ? 1 : 0)
+
+/* Monotonic seconds, for benchmarks */
+static double janus_TestSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC,&now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/* Stops the compiler from optimising a benchmark's results away */
+#define KEEP(value) __asm__ volatile("" : : "g"(value) : "memory")
+
+#endif
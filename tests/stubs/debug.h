@@ -0,0 +1,11 @@
+/*
+ * Host stand-in for the CE toolchain's debug.h
+ */
+#ifndef JANUS_HOST_DEBUG_H
+#define JANUS_HOST_DEBUG_H
+
+#include <stdio.h>
+
+#define dbg_printf printf
+
+#endif
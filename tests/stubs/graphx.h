@@ -0,0 +1,48 @@
+/*
+ * Host stand-in for the CE toolchain's graphx.h. Drawing does nothing; sprite transforms work on plain memory.
+ * Every character is treated as 8 pixels wide.
+ */
+#ifndef JANUS_HOST_GRAPHX_H
+#define JANUS_HOST_GRAPHX_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint8_t data[];
+} gfx_sprite_t;
+
+#define gfx_MallocSprite(width,height) ((gfx_sprite_t*)malloc(2 + (width) * (height)))
+
+void gfx_SetColor(uint8_t color);
+void gfx_SetTextFGColor(uint8_t color);
+void gfx_SetTextScale(uint8_t widthScale, uint8_t heightScale);
+void gfx_SetTextXY(int24_t x, int24_t y);
+void gfx_PrintString(const char* string);
+void gfx_PrintStringXY(const char* string, int24_t x, int24_t y);
+void gfx_PrintInt(int24_t n, uint8_t length);
+void gfx_PrintUInt(uint24_t n, uint8_t length);
+uint24_t gfx_GetStringWidth(const char* string);
+
+void gfx_FillRectangle(int24_t x, int24_t y, int24_t width, int24_t height);
+void gfx_FillRectangle_NoClip(uint24_t x, uint8_t y, uint24_t width, uint8_t height);
+void gfx_Rectangle_NoClip(uint24_t x, uint8_t y, uint24_t width, uint8_t height);
+void gfx_HorizLine_NoClip(uint24_t x, uint8_t y, uint24_t length);
+void gfx_TransparentSprite_NoClip(const gfx_sprite_t* sprite, uint24_t x, uint8_t y);
+
+void gfx_ShiftUp(uint8_t pixels);
+void gfx_ShiftDown(uint8_t pixels);
+void gfx_ShiftLeft(uint24_t pixels);
+void gfx_ShiftRight(uint24_t pixels);
+void gfx_SwapDraw(void);
+
+gfx_sprite_t* gfx_ScaleSprite(const gfx_sprite_t* source, gfx_sprite_t* destination);
+gfx_sprite_t* gfx_FlipSpriteY(const gfx_sprite_t* source, gfx_sprite_t* destination);
+gfx_sprite_t* gfx_FlipSpriteX(const gfx_sprite_t* source, gfx_sprite_t* destination);
+gfx_sprite_t* gfx_RotateSpriteC(const gfx_sprite_t* source, gfx_sprite_t* destination);
+gfx_sprite_t* gfx_RotateSpriteCC(const gfx_sprite_t* source, gfx_sprite_t* destination);
+gfx_sprite_t* gfx_RotateSpriteHalf(const gfx_sprite_t* source, gfx_sprite_t* destination);
+
+#endif
@@ -0,0 +1,22 @@
+/*
+ * Host stand-in for the CE toolchain's keypadc.h. Tests write kb_Data directly; kb_Scan() does nothing.
+ */
+#ifndef JANUS_HOST_KEYPADC_H
+#define JANUS_HOST_KEYPADC_H
+
+#include <stdint.h>
+
+extern volatile uint8_t kb_Data[8];
+
+/* Group 6 */
+#define kb_Enter 1
+#define kb_Clear 64
+/* Group 7 */
+#define kb_Down 1
+#define kb_Left 2
+#define kb_Right 4
+#define kb_Up 8
+
+void kb_Scan(void);
+
+#endif
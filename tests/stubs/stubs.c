@@ -0,0 +1,103 @@
+/*
+ * Host implementations of the stand-in CE toolchain functions
+ */
+#include <tice.h>
+#include <graphx.h>
+#include <keypadc.h>
+
+volatile uint8_t kb_Data[8];
+void kb_Scan(void) {}
+
+static uint32_t timerValues[4];
+void timer_Enable(uint8_t n, uint8_t rate, uint8_t inter, uint8_t direction) {}
+void timer_Disable(uint8_t n) {}
+uint32_t timer_Get(uint8_t n) { return timerValues[n & 3]; }
+void timer_Set(uint8_t n, uint32_t value) { timerValues[n & 3] = value; }
+void delay(uint16_t ms) {}
+uint32_t rtc_Time(void) { return 0; }
+
+void gfx_SetColor(uint8_t color) {}
+void gfx_SetTextFGColor(uint8_t color) {}
+void gfx_SetTextScale(uint8_t widthScale, uint8_t heightScale) {}
+void gfx_SetTextXY(int24_t x, int24_t y) {}
+void gfx_PrintString(const char* string) {}
+void gfx_PrintStringXY(const char* string, int24_t x, int24_t y) {}
+void gfx_PrintInt(int24_t n, uint8_t length) {}
+void gfx_PrintUInt(uint24_t n, uint8_t length) {}
+uint24_t gfx_GetStringWidth(const char* string) { return 8 * strlen(string); }
+
+void gfx_FillRectangle(int24_t x, int24_t y, int24_t width, int24_t height) {}
+void gfx_FillRectangle_NoClip(uint24_t x, uint8_t y, uint24_t width, uint8_t height) {}
+void gfx_Rectangle_NoClip(uint24_t x, uint8_t y, uint24_t width, uint8_t height) {}
+void gfx_HorizLine_NoClip(uint24_t x, uint8_t y, uint24_t length) {}
+void gfx_TransparentSprite_NoClip(const gfx_sprite_t* sprite, uint24_t x, uint8_t y) {}
+
+void gfx_ShiftUp(uint8_t pixels) {}
+void gfx_ShiftDown(uint8_t pixels) {}
+void gfx_ShiftLeft(uint24_t pixels) {}
+void gfx_ShiftRight(uint24_t pixels) {}
+void gfx_SwapDraw(void) {}
+
+/* Nearest-neighbour scale to the destination's size */
+gfx_sprite_t* gfx_ScaleSprite(const gfx_sprite_t* source, gfx_sprite_t* destination) {
+    int x, y;
+    for(y = 0; y < destination->height; y++) {
+        for(x = 0; x < destination->width; x++) {
+            destination->data[y * destination->width + x] = source->data[(y * source->height / destination->height) * source->width + x * source->width / destination->width];
+        }
+    }
+    return destination;
+}
+gfx_sprite_t* gfx_FlipSpriteY(const gfx_sprite_t* source, gfx_sprite_t* destination) {
+    int x, y;
+    destination->width = source->width;
+    destination->height = source->height;
+    for(y = 0; y < source->height; y++) {
+        for(x = 0; x < source->width; x++) {
+            destination->data[y * source->width + x] = source->data[y * source->width + source->width - 1 - x];
+        }
+    }
+    return destination;
+}
+gfx_sprite_t* gfx_FlipSpriteX(const gfx_sprite_t* source, gfx_sprite_t* destination) {
+    int x, y;
+    destination->width = source->width;
+    destination->height = source->height;
+    for(y = 0; y < source->height; y++) {
+        for(x = 0; x < source->width; x++) {
+            destination->data[y * source->width + x] = source->data[(source->height - 1 - y) * source->width + x];
+        }
+    }
+    return destination;
+}
+gfx_sprite_t* gfx_RotateSpriteC(const gfx_sprite_t* source, gfx_sprite_t* destination) {
+    int x, y;
+    destination->width = source->height;
+    destination->height = source->width;
+    for(y = 0; y < source->height; y++) {
+        for(x = 0; x < source->width; x++) {
+            destination->data[x * destination->width + (source->height - 1 - y)] = source->data[y * source->width + x];
+        }
+    }
+    return destination;
+}
+gfx_sprite_t* gfx_RotateSpriteCC(const gfx_sprite_t* source, gfx_sprite_t* destination) {
+    int x, y;
+    destination->width = source->height;
+    destination->height = source->width;
+    for(y = 0; y < source->height; y++) {
+        for(x = 0; x < source->width; x++) {
+            destination->data[(source->width - 1 - x) * destination->width + y] = source->data[y * source->width + x];
+        }
+    }
+    return destination;
+}
+gfx_sprite_t* gfx_RotateSpriteHalf(const gfx_sprite_t* source, gfx_sprite_t* destination) {
+    int i, size = source->width * source->height;
+    destination->width = source->width;
+    destination->height = source->height;
+    for(i = 0; i < size; i++) {
+        destination->data[i] = source->data[size - 1 - i];
+    }
+    return destination;
+}
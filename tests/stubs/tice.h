@@ -0,0 +1,37 @@
+/*
+ * Host stand-in for the CE toolchain's tice.h, just enough to build janus on a PC.
+ * int24_t and uint24_t are 32 bits wide here, so anything relying on 24-bit wraparound must mask explicitly.
+ */
+#ifndef JANUS_HOST_TICE_H
+#define JANUS_HOST_TICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+typedef int32_t int24_t;
+typedef uint32_t uint24_t;
+
+#define LCD_WIDTH 320
+#define LCD_HEIGHT 240
+
+#define TIMER_32K 1
+#define TIMER_CPU 0
+#define TIMER_0INT 1
+#define TIMER_NOINT 0
+#define TIMER_UP 0
+#define TIMER_DOWN 1
+
+void timer_Enable(uint8_t n, uint8_t rate, uint8_t inter, uint8_t direction);
+void timer_Disable(uint8_t n);
+uint32_t timer_Get(uint8_t n);
+void timer_Set(uint8_t n, uint32_t value);
+
+void delay(uint16_t ms);
+uint32_t rtc_Time(void);
+
+#define randInt(min,max) ((min) + rand() % ((max) - (min) + 1))
+
+#endif
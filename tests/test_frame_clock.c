@@ -0,0 +1,25 @@
+/*
+ * Frame limiting with the frame clock, starting from the very first frame
+ */
+#include "host.h"
+
+int main(void) {
+    struct janus_FrameClock clock;
+    struct janus_FrameStats stats;
+
+    /* 50 FPS is 20000us a frame; the host sleeps, so frames can run a little long but never short */
+    janus_InitFrameClock(&clock,50);
+    CHECK(janus_TickFrameClock(&clock) >= 20000);
+    CHECK(janus_TickFrameClock(&clock) >= 19000);
+    CHECK(clock.deltaMS >= 19);
+
+    janus_SetFrameLimit(&clock,0);
+    CHECK(clock.ticksPerFrame == 0);
+    CHECK(janus_TickFrameClock(&clock) < 20000);
+
+    janus_GetFrameStats(&clock,&stats);
+    CHECK(clock.count == 3);
+    CHECK(stats.worst >= 20000);
+
+    return TEST_RESULT("test_frame_clock");
+}
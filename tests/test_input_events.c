@@ -0,0 +1,93 @@
+/*
+ * Input queue events, key auto-repeat, dropped events and QuickUI cursor movement from events
+ */
+#include "host.h"
+
+/* Pops the next event and checks it is the one expected */
+static bool janus_TestPop(struct janus_InputQueue* queue, uint8_t group, uint8_t key, uint8_t type, uint24_t time) {
+    struct janus_InputEvent event;
+    return janus_PopInputEvent(queue,&event) && event.group == group && event.key == key && event.type == type && event.time == time;
+}
+
+int main(void) {
+    struct janus_InputQueue queue;
+    struct janus_InputEvent event;
+    struct janus_QuickUI ui;
+    uint8_t group;
+
+    /* A key pressed by one poll and released by the next */
+    janus_InitInputQueue(&queue);
+    kb_Data[6] = kb_Enter;
+    janus_PollInput(&queue,10);
+    kb_Data[6] = 0;
+    janus_PollInput(&queue,20);
+    CHECK(janus_TestPop(&queue,6,kb_Enter,JANUS_INPUT_DOWN,10));
+    CHECK(janus_TestPop(&queue,6,kb_Enter,JANUS_INPUT_UP,20));
+    CHECK(!janus_PopInputEvent(&queue,&event));
+
+    /* Held Right repeats after 400ms, then every 100ms */
+    janus_InitInputQueue(&queue);
+    janus_SetKeyRepeat(&queue,7,400,100);
+    kb_Data[7] = kb_Right;
+    janus_PollInput(&queue,0);
+    CHECK(janus_TestPop(&queue,7,kb_Right,JANUS_INPUT_DOWN,0));
+    janus_PollInput(&queue,399);
+    CHECK(!janus_PopInputEvent(&queue,&event));
+    janus_PollInput(&queue,400);
+    CHECK(janus_TestPop(&queue,7,kb_Right,JANUS_INPUT_REPEAT,400));
+    janus_PollInput(&queue,499);
+    CHECK(!janus_PopInputEvent(&queue,&event));
+    janus_PollInput(&queue,500);
+    CHECK(janus_TestPop(&queue,7,kb_Right,JANUS_INPUT_REPEAT,500));
+
+    /* A long stall gives one repeat, and repeating carries on from then */
+    janus_PollInput(&queue,2000);
+    CHECK(janus_TestPop(&queue,7,kb_Right,JANUS_INPUT_REPEAT,2000));
+    CHECK(!janus_PopInputEvent(&queue,&event));
+    janus_PollInput(&queue,2099);
+    CHECK(!janus_PopInputEvent(&queue,&event));
+    janus_PollInput(&queue,2100);
+    CHECK(janus_TestPop(&queue,7,kb_Right,JANUS_INPUT_REPEAT,2100));
+    kb_Data[7] = 0;
+    janus_PollInput(&queue,2150);
+    CHECK(janus_TestPop(&queue,7,kb_Right,JANUS_INPUT_UP,2150));
+    janus_PollInput(&queue,3000);
+    CHECK(!janus_PopInputEvent(&queue,&event));
+
+    /* Every key in groups 1-7 going down at once is more than the ring holds */
+    janus_InitInputQueue(&queue);
+    for(group = 1; group < KB_DATA_SIZE; group++) {
+        kb_Data[group] = 0xFF;
+    }
+    janus_PollInput(&queue,0);
+    CHECK(queue.eventCount == JANUS_INPUT_MAX_EVENTS);
+    CHECK(queue.dropped == (KB_DATA_SIZE - 1) * 8 - JANUS_INPUT_MAX_EVENTS);
+    CHECK(janus_TestPop(&queue,1,0x01,JANUS_INPUT_DOWN,0));
+    for(group = 1; group < KB_DATA_SIZE; group++) {
+        kb_Data[group] = 0;
+    }
+
+    /* The QuickUI cursor moves on the first press and on every repeat, and Enter selects when released */
+    memset(&ui,0,sizeof(ui));
+    ui.numberOfOptions = 4;
+    janus_InitInputQueue(&queue);
+    janus_SetKeyRepeat(&queue,7,400,100);
+    kb_Data[7] = kb_Down;
+    janus_PollInput(&queue,0);
+    janus_PollInput(&queue,400);
+    janus_PollInput(&queue,500);
+    kb_Data[7] = 0;
+    janus_PollInput(&queue,550);
+    while(janus_PopInputEvent(&queue,&event)) {
+        CHECK(!janus_HandleQuickUIEvent(&ui,&event));
+    }
+    CHECK(ui.cursorPosition == 3);
+    kb_Data[6] = kb_Enter;
+    janus_PollInput(&queue,600);
+    CHECK(janus_PopInputEvent(&queue,&event) && !janus_HandleQuickUIEvent(&ui,&event));
+    kb_Data[6] = 0;
+    janus_PollInput(&queue,650);
+    CHECK(janus_PopInputEvent(&queue,&event) && janus_HandleQuickUIEvent(&ui,&event));
+
+    return TEST_RESULT("test_input_events");
+}
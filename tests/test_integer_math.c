@@ -0,0 +1,90 @@
+/*
+ * Reciprocal division, square roots and powers, exhaustively over the int24 range where it matters
+ */
+#include "host.h"
+
+#define INT24_MIN_VALUE (-(1 << 23) + 1)
+#define INT24_MAX_VALUE ((1 << 23) - 1)
+
+/* Divisors worth covering exhaustively: small, powers of two and their neighbours, JANUS_ONE_SECOND and the largest int24 */
+static const uint24_t divisors[] = {
+    1, 2, 3, 7, 10, 60, 100, 125, 255, 256, 1000, 1023, 1024, 4095, 4096, 4097, 65535, 100000, 1 << 22, INT24_MAX_VALUE
+};
+
+int main(void) {
+    struct janus_Reciprocal reciprocal;
+    uint24_t i, divisor;
+    int24_t value;
+    uint32_t squared, root;
+    long wrong = 0;
+
+    /* JANUS_APPLY_DELTA_TIME divides every physics and ease step by JANUS_ONE_SECOND; check every possible dividend */
+    for(value = INT24_MIN_VALUE; value <= INT24_MAX_VALUE; value++) {
+        if(janus_DivideByOneSecond(value) != value / JANUS_ONE_SECOND) {
+            wrong++;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(JANUS_APPLY_DELTA_TIME(250,16) == 4);
+    CHECK(JANUS_APPLY_DELTA_TIME(-250,16) == -4);
+
+    for(i = 0; i < sizeof(divisors) / sizeof(divisors[0]); i++) {
+        janus_InitReciprocal(&reciprocal,divisors[i]);
+        wrong = 0;
+        for(value = INT24_MIN_VALUE; value <= INT24_MAX_VALUE; value++) {
+            if(janus_DivideByReciprocal(value,&reciprocal) != value / (int24_t)divisors[i]) {
+                wrong++;
+            }
+        }
+        if(wrong != 0) {
+            fprintf(stderr,"dividing by %u: %ld wrong\n",divisors[i],wrong);
+        }
+        CHECK(wrong == 0);
+    }
+
+    /* Random divisors against random dividends */
+    srand(1);
+    wrong = 0;
+    for(i = 0; i < 20000; i++) {
+        uint24_t k;
+        divisor = 1 + rand() % INT24_MAX_VALUE;
+        janus_InitReciprocal(&reciprocal,divisor);
+        for(k = 0; k < 500; k++) {
+            value = rand() % (1 << 24) + INT24_MIN_VALUE;
+            if(janus_DivideByReciprocal(value,&reciprocal) != value / (int24_t)divisor) {
+                wrong++;
+            }
+        }
+    }
+    CHECK(wrong == 0);
+
+    /* Square roots round down for every 24-bit input and the top of the 32-bit range */
+    wrong = 0;
+    for(squared = 0; squared < (1u << 24); squared++) {
+        root = janus_SquareRoot(squared);
+        if((uint64_t)root * root > squared || (uint64_t)(root + 1) * (root + 1) <= squared) {
+            wrong++;
+        }
+    }
+    for(squared = 0xFFFFFFFF; squared > 0xFFFFFFFF - 1000000; squared--) {
+        root = janus_SquareRoot(squared);
+        if((uint64_t)root * root > squared || (uint64_t)(root + 1) * (root + 1) <= squared) {
+            wrong++;
+        }
+    }
+    CHECK(wrong == 0);
+
+    /* Powers match repeated multiplication wherever the result fits in int24 */
+    for(value = -20; value <= 20; value++) {
+        int24_t exponent;
+        long expected = 1;
+        for(exponent = 0; exponent < 12; exponent++) {
+            if(labs(expected) <= INT24_MAX_VALUE) {
+                CHECK(janus_Pow(value,exponent) == expected);
+            }
+            expected *= value;
+        }
+    }
+
+    return TEST_RESULT("test_integer_math");
+}
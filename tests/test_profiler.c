@@ -0,0 +1,49 @@
+/*
+ * Profiler zone history, stats and CSV output
+ */
+#include "host.h"
+
+int main(void) {
+    struct janus_ProfilerStats stats;
+    char line[256];
+    FILE* file;
+    uint24_t frame, rows = 0;
+
+    janus_InitProfiler();
+    janus_NameProfilerZone(0,"update");
+    janus_NameProfilerZone(2,"render");
+    for(frame = 0; frame < JANUS_PROFILER_HISTORY + 5; frame++) {
+        JANUS_PROFILE_BEGIN(0);
+        JANUS_PROFILE_END(0);
+        JANUS_PROFILE_BEGIN(2);
+        JANUS_PROFILE_END(2);
+        janus_EndProfilerFrame();
+    }
+    CHECK(janus_Profiler.frameCount == JANUS_PROFILER_HISTORY + 5);
+    CHECK(janus_Profiler.historyCount == JANUS_PROFILER_HISTORY);
+
+    /* Hand-written history so the stats are exact */
+    for(frame = 0; frame < JANUS_PROFILER_HISTORY; frame++) {
+        janus_Profiler.history[frame][0] = (frame + 1) * JANUS_TIMER_TICKS_PER_US;
+    }
+    janus_GetProfilerStats(0,&stats);
+    CHECK(stats.minimum == 1);
+    CHECK(stats.maximum == JANUS_PROFILER_HISTORY);
+    CHECK(stats.average == (JANUS_PROFILER_HISTORY + 1) / 2);
+
+    /* One header row, then one row per frame of history with a column per named zone */
+    file = tmpfile();
+    CHECK(file != NULL);
+    if(file != NULL) {
+        janus_DumpProfilerCSV(file);
+        rewind(file);
+        CHECK(fgets(line,sizeof(line),file) != NULL && strcmp(line,"frame,update,render\n") == 0);
+        while(fgets(line,sizeof(line),file) != NULL) {
+            rows++;
+        }
+        fclose(file);
+    }
+    CHECK(rows == JANUS_PROFILER_HISTORY);
+
+    return TEST_RESULT("test_profiler");
+}
@@ -0,0 +1,46 @@
+/*
+ * Rect raycasts skip rects on layers outside the ray's mask, and tile map raycasts stay exact over long rays
+ */
+#include "host.h"
+
+#define LAYER_WALLS 0x01
+#define LAYER_GLASS 0x02
+
+int main(void) {
+    /* Glass in front of a wall, both across the ray's path */
+    struct janus_Rect rects[2] = {
+        {{50,-20},{10,40},LAYER_GLASS,0},
+        {{100,-20},{10,40},LAYER_WALLS,0}
+    };
+    struct janus_Vector2 origin = {0,0};
+    struct janus_Vector2 rays[2] = {{200,0},{200,5}};
+    struct janus_RayHit hit, hits[2];
+    /* 128x128 tiles of 16 pixels, with only tile (100,100) solid */
+    static uint8_t solid[128 * 16];
+    struct janus_TileMap map = {solid,128,128,4,{0,0},0};
+    struct janus_Vector2 longRay = {1700,1700};
+
+    CHECK(janus_RaycastRects(&origin,&rays[0],rects,2,0,&hit));
+    CHECK(hit.index == 0 && hit.position.x == 50);
+
+    /* Sight sees through glass */
+    CHECK(janus_RaycastRects(&origin,&rays[0],rects,2,LAYER_WALLS,&hit));
+    CHECK(hit.index == 1 && hit.position.x == 100);
+
+    CHECK(!janus_RaycastRects(&origin,&rays[0],rects,1,LAYER_WALLS,&hit));
+    CHECK(hit.index == -1);
+
+    CHECK(janus_RaycastRectsBatch(&origin,rays,2,rects,2,LAYER_WALLS,hits) == 2);
+    CHECK(hits[0].index == 1 && hits[1].index == 1);
+    CHECK(janus_RaycastRectsBatch(&origin,rays,2,rects,2,LAYER_GLASS | LAYER_WALLS,hits) == 2);
+    CHECK(hits[0].index == 0 && hits[1].index == 0);
+
+    /* Crossing times reach 1700 * 1700 here, so the final scaling would overflow 32 bits if done directly */
+    solid[100 * 16 + (100 >> 3)] = 0x80 >> (100 & 7);
+    CHECK(janus_RaycastTileMap(&map,&origin,&longRay,&hit));
+    CHECK(hit.index == 100 * 128 + 100);
+    CHECK(hit.position.x == 1600 && hit.position.y == 1600);
+    CHECK(hit.distance >= 940 && hit.distance <= 942);
+
+    return TEST_RESULT("test_raycast_layers");
+}
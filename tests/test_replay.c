@@ -0,0 +1,119 @@
+/*
+ * Records a scripted game loop, replays it headless, and compares a hash of the game state every frame
+ */
+#include "host.h"
+
+#define FRAMES 600
+
+struct Game {
+    int24_t x, y;
+    int24_t clock;
+    uint24_t presses;
+    uint24_t events;
+    uint8_t lastEnter;
+};
+
+/* Keys pressed on a given frame of the recorded run; some are held for a while, some only for one frame */
+static void janus_TestScriptKeys(uint24_t frame) {
+    kb_Data[7] = 0;
+    if(frame % 40 < 25) {
+        kb_Data[7] |= kb_Right;
+    }
+    if(frame % 7 == 0) {
+        kb_Data[7] |= kb_Up;
+    }
+    if(frame % 90 > 60) {
+        kb_Data[7] |= kb_Left;
+    }
+    kb_Data[6] = frame % 13 == 5 ? kb_Enter : 0;
+}
+
+/* One frame in the same order as main.c, with the stand-in kb_Scan() replaced by the script */
+static uint24_t janus_TestFrame(struct Game* game, struct janus_InputQueue* queue, uint24_t frame, bool scripted) {
+    struct janus_InputEvent event;
+    int24_t deltaMS;
+    uint24_t hash = JANUS_HASH_START;
+
+    kb_Scan();
+    if(scripted) {
+        janus_TestScriptKeys(frame);
+    }
+    deltaMS = janus_GetDeltaTime();
+    janus_UpdateDebouncedKeys();
+
+    game->clock += deltaMS;
+    if(janus_GetKeyGroup(7) & kb_Right) {
+        game->x += 3;
+    }
+    if(janus_GetKeyGroup(7) & kb_Left) {
+        game->x -= 2;
+    }
+    if(janus_PressedKeys[7] & kb_Up) {
+        game->y += game->x & 7;
+        game->presses++;
+    }
+    janus_PollInput(queue,game->clock);
+    while(janus_PopInputEvent(queue,&event)) {
+        game->events += event.group * 16 + event.key + event.type;
+    }
+    /* Reads the keypad again after it was taken, as janus_RenderQuickUI(...) does */
+    game->lastEnter = janus_GetKeyGroup(6) & kb_Enter;
+
+    /* The keypad changing mid-frame mustn't matter; the frame keeps the keys it first read */
+    if(scripted) {
+        kb_Data[7] ^= 0xFF;
+    }
+
+    hash = janus_HashBytes(hash,game,sizeof(struct Game));
+    return janus_HashBytes(hash,janus_PressedKeys,sizeof(janus_PressedKeys));
+}
+
+int main(void) {
+    static uint8_t buffer[4096];
+    static uint24_t hashes[FRAMES];
+    struct janus_InputRecording recording;
+    struct janus_InputQueue queue;
+    struct Game game;
+    uint24_t size, frame, mismatches = 0;
+    clock_t start;
+
+    /* Up and Right are already held when recording starts, so frame 0 mustn't see them as pressed */
+    kb_Data[7] = kb_Up | kb_Right;
+    janus_UpdateDebouncedKeys();
+    memset(&game,0,sizeof(game));
+    janus_InitInputQueue(&queue);
+    janus_SetKeyRepeat(&queue,7,200,50);
+    janus_StartRecording(&recording,buffer,sizeof(buffer));
+    for(frame = 0; frame < FRAMES; frame++) {
+        hashes[frame] = janus_TestFrame(&game,&queue,frame,true);
+    }
+    size = janus_StopRecording(&recording);
+    CHECK(!recording.overflowed);
+    CHECK(recording.frameCount == FRAMES);
+    CHECK(game.presses > 0);
+
+    /* Replaying straight after, with the keypad and debouncer left as the recording's last frame had them; the replay has to put Up and Right back */
+    memset(&game,0,sizeof(game));
+    janus_InitInputQueue(&queue);
+    janus_SetKeyRepeat(&queue,7,200,50);
+    janus_StartReplay(&recording,buffer,size);
+    for(frame = 0; frame < FRAMES; frame++) {
+        if(janus_TestFrame(&game,&queue,frame,false) != hashes[frame]) {
+            if(mismatches++ == 0) {
+                fprintf(stderr,"replay first differs on frame %u\n",(unsigned)frame);
+            }
+        }
+    }
+    CHECK(mismatches == 0);
+    CHECK(recording.replaying);
+
+    /* However long the replay took, the first real frame after it ends is timed from its end */
+    start = clock();
+    while(clock() - start < CLOCKS_PER_SEC / 20) {
+    }
+    CHECK(janus_GetDeltaTime() < 20);
+    CHECK(!recording.replaying);
+    janus_StopReplay(&recording);
+
+    return TEST_RESULT("test_replay");
+}
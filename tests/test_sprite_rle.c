@@ -0,0 +1,120 @@
+/*
+ * Compressed sprites round-trip exactly, and the frame cache keeps consistent counters
+ */
+#include "host.h"
+
+#define MAX_COMPRESSED (2 + JANUS_FRAME_CACHE_MAX_PIXELS * 2)
+
+static uint8_t spriteData[2 + JANUS_FRAME_CACHE_MAX_PIXELS * 2];
+static uint8_t decompressedData[2 + JANUS_FRAME_CACHE_MAX_PIXELS];
+static uint8_t compressed[MAX_COMPRESSED];
+
+/* Fills a sprite with one of several patterns: noise, flat colour, runs of every length, or alternating literals and runs */
+static gfx_sprite_t* makeSprite(uint8_t width, uint8_t height, uint8_t pattern) {
+    gfx_sprite_t* sprite = (gfx_sprite_t*)spriteData;
+    uint24_t i, pixelCount = width * height;
+    sprite->width = width;
+    sprite->height = height;
+    for(i = 0; i < pixelCount; i++) {
+        switch(pattern) {
+            case 0:
+                sprite->data[i] = rand() & 0xFF;
+                break;
+            case 1:
+                sprite->data[i] = 7;
+                break;
+            case 2:
+                /* Runs of 1, 2, 3 ... 200 pixels */
+                {
+                    uint24_t length = 1, start = 0, colour = 0;
+                    while(start + length <= i) {
+                        start += length;
+                        length = length % 200 + 1;
+                        colour++;
+                    }
+                    sprite->data[i] = colour & 0xFF;
+                }
+                break;
+            default:
+                sprite->data[i] = (i / 5) % 2 ? 3 : rand() % 4;
+                break;
+        }
+    }
+    return sprite;
+}
+
+static void checkRoundTrip(uint8_t width, uint8_t height, uint8_t pattern) {
+    gfx_sprite_t* sprite = makeSprite(width,height,pattern);
+    gfx_sprite_t* decompressed = (gfx_sprite_t*)decompressedData;
+    uint24_t pixelCount = width * height;
+    uint24_t size = janus_CompressSprite(sprite,compressed,MAX_COMPRESSED);
+    CHECK(size >= 2);
+    memset(decompressedData,0xEE,sizeof(decompressedData));
+    CHECK(janus_DecompressSprite(compressed,decompressed) == decompressed);
+    CHECK(decompressed->width == width && decompressed->height == height);
+    CHECK(memcmp(decompressed->data,sprite->data,pixelCount) == 0);
+    /* Nothing written past the sprite */
+    if(pixelCount < JANUS_FRAME_CACHE_MAX_PIXELS) {
+        CHECK(decompressed->data[pixelCount] == 0xEE);
+    }
+    /* Worst case is one control byte per 128 literals */
+    CHECK(size <= 2 + pixelCount + (pixelCount + 127) / 128);
+    /* A flat sprite is two bytes per 128 pixels, plus at most one short literal tail */
+    if(pattern == 1) {
+        CHECK(size <= 2 + 2 * ((pixelCount + 127) / 128) + 1);
+    }
+}
+
+int main(void) {
+    static struct janus_FrameCache cache;
+    static uint8_t frames[JANUS_FRAME_CACHE_SLOTS + 1][64];
+    gfx_sprite_t* sprite;
+    uint8_t width, height, pattern, i;
+
+    srand(19);
+    for(pattern = 0; pattern < 4; pattern++) {
+        for(width = 1; width <= 40; width += 3) {
+            for(height = 1; height <= 25; height += 4) {
+                checkRoundTrip(width,height,pattern);
+            }
+        }
+        checkRoundTrip(255,4,pattern);
+        checkRoundTrip(32,32,pattern);
+    }
+
+    /* Frames too big for a cache slot are refused when compressing */
+    sprite = makeSprite(33,32,1);
+    CHECK(janus_CompressSprite(sprite,compressed,MAX_COMPRESSED) == 0);
+    /* Output too small */
+    sprite = makeSprite(16,16,0);
+    CHECK(janus_CompressSprite(sprite,compressed,40) == 0);
+
+    /* Cache: each frame is a 4x4 sprite of its own colour */
+    janus_InitFrameCache(&cache);
+    for(i = 0; i <= JANUS_FRAME_CACHE_SLOTS; i++) {
+        sprite = makeSprite(4,4,1);
+        memset(sprite->data,i,16);
+        CHECK(janus_CompressSprite(sprite,frames[i],sizeof(frames[i])) != 0);
+    }
+    for(i = 0; i < JANUS_FRAME_CACHE_SLOTS; i++) {
+        sprite = janus_GetCachedFrame(&cache,frames[i]);
+        CHECK(sprite != NULL && sprite->data[15] == i);
+    }
+    CHECK(cache.misses == JANUS_FRAME_CACHE_SLOTS && cache.hits == 0);
+    /* Touch frame 0 so frame 1 becomes the least recently used, then push frame 1 out */
+    CHECK(janus_GetCachedFrame(&cache,frames[0])->data[0] == 0);
+    CHECK(janus_GetCachedFrame(&cache,frames[JANUS_FRAME_CACHE_SLOTS])->data[0] == JANUS_FRAME_CACHE_SLOTS);
+    CHECK(cache.hits == 1 && cache.misses == JANUS_FRAME_CACHE_SLOTS + 1);
+    CHECK(janus_GetCachedFrame(&cache,frames[0])->data[0] == 0);
+    CHECK(cache.hits == 2);
+    CHECK(janus_GetCachedFrame(&cache,frames[1])->data[0] == 1);
+    CHECK(cache.misses == JANUS_FRAME_CACHE_SLOTS + 2);
+
+    /* Hand-made data that's too big gives NULL and leaves the counters alone */
+    compressed[0] = 64;
+    compressed[1] = 64;
+    CHECK(janus_GetCachedFrame(&cache,compressed) == NULL);
+    CHECK(cache.uses == cache.hits + cache.misses);
+
+    return TEST_RESULT("test_sprite_rle");
+}
@@ -0,0 +1,45 @@
+/*
+ * Swept rects and rect raycasts across gaps too wide for distance * 1000 to fit in 24 bits
+ */
+#include "host.h"
+
+int main(void) {
+    struct janus_Rect moving = {{0,0},{10,10},0,0};
+    struct janus_Rect wall = {{20010,0},{200,10},0,0};
+    struct janus_Vector2 movement = {40000,0};
+    struct janus_Vector2 origin = {5,5};
+    struct janus_Vector2 ray = {-30000,0};
+    struct janus_Rect farLeft = {{-15095,0},{100,10},0,0};
+    /* Diagonal moves whose cross-axis offset times the entry time (20000 * 500) is past the int24 limit; an int24 product would land at -6777 instead of 10000 */
+    struct janus_Rect tallWall = {{20010,0},{200,20000},0,0};
+    struct janus_Vector2 diagonal = {40000,20000};
+    struct janus_Rect tallLeft = {{-15095,-10},{100,20000},0,0};
+    struct janus_Vector2 diagonalRay = {-30000,20000};
+    struct janus_SweepHit sweep;
+    struct janus_RayHit hit;
+
+    /* The gap is 20000 px, so the old int24 product (20000000) wrapped */
+    CHECK(janus_SweepRect(&moving,&movement,&wall,&sweep));
+    CHECK(sweep.time == 500);
+    CHECK(sweep.position.x == 20000);
+    CHECK(sweep.normal.x == -1 && sweep.normal.y == 0);
+
+    /* Too short a move to get there: the entry time is clamped, not wrapped into range */
+    movement.x = 1;
+    CHECK(!janus_SweepRect(&moving,&movement,&wall,&sweep));
+
+    CHECK(janus_RaycastRect(&origin,&ray,&farLeft,&hit));
+    CHECK(hit.distance == 500);
+    CHECK(hit.position.x == -14995);
+    CHECK(hit.normal.x == 1);
+
+    CHECK(janus_SweepRect(&moving,&diagonal,&tallWall,&sweep));
+    CHECK(sweep.time == 500);
+    CHECK(sweep.position.x == 20000 && sweep.position.y == 10000);
+
+    CHECK(janus_RaycastRect(&origin,&diagonalRay,&tallLeft,&hit));
+    CHECK(hit.distance == 500);
+    CHECK(hit.position.x == -14995 && hit.position.y == 10005);
+
+    return TEST_RESULT("test_sweep");
+}
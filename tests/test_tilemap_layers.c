@@ -0,0 +1,40 @@
+/*
+ * Tile map collisions honour the map's layer and the object's mask
+ */
+#include "host.h"
+
+#define LAYER_TERRAIN 0x01
+#define LAYER_GHOSTS 0x02
+
+/* One row of four 16x16 tiles, all solid */
+static const uint8_t floorTiles[] = {0xF0};
+
+static void dropOnto(struct janus_PhysicsObject* object, uint8_t mask) {
+    memset(object,0,sizeof(struct janus_PhysicsObject));
+    object->rect = (struct janus_Rect){{8,-4},{8,8},0,mask};
+    object->resistance = 1;
+}
+
+int main(void) {
+    struct janus_TileMap map = {floorTiles,4,1,4,{0,0},LAYER_TERRAIN};
+    struct janus_PhysicsObject object;
+
+    dropOnto(&object,0);
+    CHECK(janus_HandleObjectTileMapCollision(&object,&map));
+    CHECK(object.rect.position.y == -8);
+
+    dropOnto(&object,LAYER_TERRAIN);
+    CHECK(janus_HandleObjectTileMapCollision(&object,&map));
+    CHECK(object.rect.position.y == -8);
+
+    /* A ghost's mask leaves terrain out, so it sinks into the floor */
+    dropOnto(&object,LAYER_GHOSTS);
+    CHECK(!janus_HandleObjectTileMapCollision(&object,&map));
+    CHECK(object.rect.position.y == -4);
+
+    /* A map left on layer 0 is on every layer */
+    map.layer = 0;
+    CHECK(janus_HandleObjectTileMapCollision(&object,&map));
+
+    return TEST_RESULT("test_tilemap_layers");
+}
@@ -0,0 +1,24 @@
+/*
+ * Fixed timestep accumulation, including a step length of zero
+ */
+#include "host.h"
+
+int main(void) {
+    struct janus_Timestep timestep = {JANUS_ONE_SECOND / 50,4,0,0};
+    struct janus_Timestep broken = {0,4,0,0};
+
+    CHECK(janus_AccumulateTimestep(&timestep,50) == 2);
+    CHECK(timestep.accumulator == 10);
+    CHECK(timestep.alpha == 500);
+
+    /* A huge frame runs maxSteps and keeps only the fraction of a step */
+    CHECK(janus_AccumulateTimestep(&timestep,1000) == 4);
+    CHECK(timestep.accumulator == 10);
+
+    CHECK(janus_AccumulateTimestep(&broken,16) == 0);
+    CHECK(broken.alpha == 0);
+    broken.stepMS = -5;
+    CHECK(janus_AccumulateTimestep(&broken,16) == 0);
+
+    return TEST_RESULT("test_timestep");
+}
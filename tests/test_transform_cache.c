@@ -0,0 +1,95 @@
+/*
+ * Transform cache lookups, LRU eviction and compaction, the memory cap and the counters
+ */
+#include "host.h"
+
+/* A 16x16 sprite whose pixels all differ from its mirror image, tagged so different sprites differ too */
+static gfx_sprite_t* janus_TestSprite(uint8_t tag) {
+    gfx_sprite_t* sprite = gfx_MallocSprite(16,16);
+    uint24_t i;
+    sprite->width = 16;
+    sprite->height = 16;
+    for(i = 0; i < 16 * 16; i++) {
+        sprite->data[i] = (uint8_t)(i * 7 + tag);
+    }
+    return sprite;
+}
+
+/* Whether transformed is sprite scaled by 4, and mirrored if mirrored is set */
+static bool janus_TestIsScaled(const gfx_sprite_t* transformed, const gfx_sprite_t* sprite, bool mirrored) {
+    uint24_t x, y, sourceX;
+    if(transformed->width != 64 || transformed->height != 64) {
+        return false;
+    }
+    for(y = 0; y < 64; y++) {
+        for(x = 0; x < 64; x++) {
+            sourceX = mirrored ? 15 - x / 4 : x / 4;
+            if(transformed->data[y * 64 + x] != sprite->data[(y / 4) * 16 + sourceX]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    static struct janus_TransformCache cache;
+    gfx_sprite_t* a = janus_TestSprite(1);
+    gfx_sprite_t* b = janus_TestSprite(2);
+    gfx_sprite_t* c = janus_TestSprite(3);
+    gfx_sprite_t* d = janus_TestSprite(4);
+    gfx_sprite_t* huge = gfx_MallocSprite(100,100);
+    gfx_sprite_t* tiny = gfx_MallocSprite(1,1);
+    gfx_sprite_t* result;
+    gfx_sprite_t* first;
+    uint8_t i;
+
+    janus_InitTransformCache(&cache);
+
+    /* A mirrored 4x 16x16 sprite fits, scratch copy and all */
+    first = janus_GetTransformedSprite(&cache,a,JANUS_TRANSFORM_MIRROR,4);
+    CHECK(first != NULL && janus_TestIsScaled(first,a,true));
+    CHECK(cache.bytesUsed == 2 + 64 * 64);
+    result = janus_GetTransformedSprite(&cache,b,0,4);
+    CHECK(result != NULL && janus_TestIsScaled(result,b,false));
+    CHECK(janus_GetTransformedSprite(&cache,a,JANUS_TRANSFORM_MIRROR,4) == first);
+    CHECK(cache.uses == 3 && cache.hits == 1 && cache.misses == 2 && cache.evictions == 0);
+
+    /* c fits beside them; then d needs room for its scratch copy too, so b (least recently used) and then a go, and c slides down */
+    CHECK(janus_GetTransformedSprite(&cache,c,0,4) != NULL);
+    CHECK(cache.evictions == 0);
+    result = janus_GetTransformedSprite(&cache,d,JANUS_TRANSFORM_MIRROR,4);
+    CHECK(result != NULL && janus_TestIsScaled(result,d,true));
+    CHECK(cache.evictions == 2);
+    CHECK(cache.spriteCount == 2 && cache.bytesUsed == 2 * (2 + 64 * 64));
+    result = janus_GetTransformedSprite(&cache,c,0,4);
+    CHECK(result == (gfx_sprite_t*)cache.memory && janus_TestIsScaled(result,c,false));
+    CHECK(cache.hits == 2);
+    CHECK(janus_GetTransformedSprite(&cache,b,0,4) != NULL);
+    CHECK(cache.misses == 5);
+
+    /* Too wide once scaled, or too big for the cache with its scratch copy; neither is counted */
+    huge->width = 100;
+    huge->height = 100;
+    CHECK(janus_GetTransformedSprite(&cache,a,0,16) == NULL);
+    CHECK(janus_GetTransformedSprite(&cache,huge,JANUS_TRANSFORM_MIRROR | JANUS_TRANSFORM_FLIP,1) == NULL);
+    CHECK(cache.uses == cache.hits + cache.misses);
+
+    /* Running out of entries evicts as well */
+    janus_InitTransformCache(&cache);
+    tiny->width = 1;
+    tiny->height = 1;
+    for(i = 0; i < JANUS_TRANSFORM_CACHE_ENTRIES + 1; i++) {
+        CHECK(janus_GetTransformedSprite(&cache,tiny,0,i + 1) != NULL);
+    }
+    CHECK(cache.spriteCount == JANUS_TRANSFORM_CACHE_ENTRIES && cache.evictions == 1);
+    CHECK(cache.uses == cache.hits + cache.misses);
+
+    free(a);
+    free(b);
+    free(c);
+    free(d);
+    free(huge);
+    free(tiny);
+    return TEST_RESULT("test_transform_cache");
+}
@@ -0,0 +1,53 @@
+/*
+ * Fixed point trig against libm
+ */
+#include "host.h"
+#include <math.h>
+
+#define PI 3.14159265358979323846
+
+int main(void) {
+    int24_t angle, x, y;
+    double worstAtan = 0;
+
+    /* Sines and cosines round exactly */
+    for(angle = 0; angle < 256; angle++) {
+        CHECK(fabs(janus_SinFixed(angle) - 256 * sin(angle * 2 * PI / 256)) <= 0.5);
+        CHECK(fabs(janus_CosFixed(angle) - 256 * cos(angle * 2 * PI / 256)) <= 0.5);
+    }
+
+    /* atan2 lands within one step of the true angle everywhere */
+    for(y = -300; y <= 300; y += 3) {
+        for(x = -300; x <= 300; x += 3) {
+            double expected, error;
+            if(x == 0 && y == 0) {
+                continue;
+            }
+            expected = atan2(y,x) * 256 / (2 * PI);
+            if(expected < 0) {
+                expected += 256;
+            }
+            error = fabs(janus_Atan2(y,x) - expected);
+            if(error > 128) {
+                error = 256 - error;
+            }
+            if(error > worstAtan) {
+                worstAtan = error;
+            }
+        }
+    }
+    CHECK(worstAtan <= 1.0);
+
+    /* Lengths are the floor of the true length; normalized vectors are within a couple of units of the asked-for length */
+    for(y = -32767; y <= 32767; y += 97) {
+        for(x = -32767; x <= 32767; x += 89) {
+            struct janus_Vector2 vector = {x,y}, normalized;
+            CHECK(janus_VectorLength(&vector) == (uint24_t)floor(sqrt((double)x * x + (double)y * y)));
+            normalized = janus_NormalizeVector(&vector,256);
+            CHECK(fabs(sqrt((double)normalized.x * normalized.x + (double)normalized.y * normalized.y) - 256) <= 2.5);
+        }
+    }
+
+    printf("trig: worst atan2 error %.2f steps\n",worstAtan);
+    return TEST_RESULT("test_trig");
+}
@@ -0,0 +1,38 @@
+/*
+ * Objects sleeping on a world rect wake up and fall once the rect is moved away
+ */
+#include "host.h"
+
+int main(void) {
+    static struct janus_PhysicsWorld world;
+    struct janus_PhysicsObject box = {{{50,90},{10,10},0,0},{0,0},1,false,false,{50,90},false,0};
+    struct janus_Rect floor = {{0,100},{200,10},0,0};
+    struct janus_PhysicsObject* object;
+    struct janus_Rect* rect;
+    uint8_t step;
+
+    janus_InitWorld(&world);
+    world.gravity = (struct janus_Vector2){0,20};
+    object = janus_AddWorldObject(&world,&box);
+    rect = janus_AddWorldRect(&world,&floor);
+    CHECK(object != NULL && rect != NULL);
+
+    for(step = 0; step < 120 && !object->sleeping; step++) {
+        janus_StepWorld(&world,16);
+    }
+    CHECK(object->sleeping);
+    CHECK(object->rect.position.y == 90);
+
+    /* Move the floor out from under the box */
+    rect->position.y = 200;
+    world.rectsChanged = true;
+    janus_StepWorld(&world,16);
+    CHECK(!object->sleeping);
+    for(step = 0; step < 120; step++) {
+        janus_StepWorld(&world,16);
+    }
+    /* It falls and comes to rest on the floor where it is now */
+    CHECK(object->rect.position.y == 190);
+
+    return TEST_RESULT("test_world_sleep");
+}